@@ -0,0 +1,234 @@
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "harness.hpp"
+#include "pine/core/layer.hpp"
+#include "pine/events/event_queue.hpp"
+#include "pine/events/event_variant.hpp"
+
+namespace
+{
+
+constexpr uint64_t event_count = 1000000;
+constexpr uint32_t layer_count = 10;
+
+// Synthetic input with a mix of event types. Mouse moves are interleaved
+// with other events, so that the event queue does not coalesce them.
+std::vector<pine::EventVariant> create_events()
+{
+    std::vector<pine::EventVariant> events;
+    events.reserve(event_count);
+    for (uint64_t index = 0; index < event_count; index++)
+    {
+        const auto value = static_cast<float>(index);
+        switch (index % 6)
+        {
+        case 0:
+            events.emplace_back(pine::MouseMovedEvent(value, value));
+            break;
+        case 1:
+            events.emplace_back(pine::KeyPressedEvent(pine::Key::A, 0));
+            break;
+        case 2:
+            events.emplace_back(pine::MouseScrolledEvent(0.0f, 1.0f));
+            break;
+        case 3:
+            events.emplace_back(
+                pine::MouseButtonPressedEvent(pine::Mouse::Button0));
+            break;
+        case 4:
+            events.emplace_back(pine::KeyReleasedEvent(pine::Key::A));
+            break;
+        case 5:
+            events.emplace_back(pine::WindowResizeEvent(1600, 800));
+            break;
+        }
+    }
+    return events;
+}
+
+pine::Event& get_event(pine::EventVariant& variant)
+{
+    return std::visit([](auto& event) -> pine::Event& { return event; },
+        variant);
+}
+
+// Handles three event types, like a typical layer, without consuming them.
+class DispatcherLayer : public pine::Layer
+{
+public:
+    void on_event(pine::Event& event) override
+    {
+        pine::EventDispatcher dispatcher(event);
+        dispatcher.dispatch<pine::MouseMovedEvent>(
+            [this](pine::MouseMovedEvent& event)
+            {
+                sum += static_cast<uint64_t>(event.get_x());
+                return false;
+            });
+        dispatcher.dispatch<pine::MouseScrolledEvent>(
+            [this](pine::MouseScrolledEvent& event)
+            {
+                sum += static_cast<uint64_t>(event.get_offset_y());
+                return false;
+            });
+        dispatcher.dispatch<pine::KeyPressedEvent>(
+            [this](pine::KeyPressedEvent& event)
+            {
+                sum += static_cast<uint64_t>(event.GetKeyCode());
+                return false;
+            });
+    }
+
+    uint64_t sum = 0;
+};
+
+class HandlerTableLayer : public pine::Layer
+{
+public:
+    HandlerTableLayer()
+    {
+        handlers.set<pine::MouseMovedEvent>(
+            [this](pine::MouseMovedEvent& event)
+            {
+                sum += static_cast<uint64_t>(event.get_x());
+                return false;
+            });
+        handlers.set<pine::MouseScrolledEvent>(
+            [this](pine::MouseScrolledEvent& event)
+            {
+                sum += static_cast<uint64_t>(event.get_offset_y());
+                return false;
+            });
+        handlers.set<pine::KeyPressedEvent>(
+            [this](pine::KeyPressedEvent& event)
+            {
+                sum += static_cast<uint64_t>(event.GetKeyCode());
+                return false;
+            });
+    }
+
+    void on_event(pine::Event& event) override { handlers.dispatch(event); }
+
+    pine::EventHandlerTable handlers;
+    uint64_t sum = 0;
+};
+
+class VisitLayer : public pine::Layer
+{
+public:
+    void on_event(pine::Event& event) override
+    {
+        pine::visit_event(event,
+            pine::EventOverloads{
+                [this](pine::MouseMovedEvent& event)
+                {
+                    sum += static_cast<uint64_t>(event.get_x());
+                },
+                [this](pine::MouseScrolledEvent& event)
+                {
+                    sum += static_cast<uint64_t>(event.get_offset_y());
+                },
+                [this](pine::KeyPressedEvent& event)
+                {
+                    sum += static_cast<uint64_t>(event.GetKeyCode());
+                },
+                [](pine::Event&) {}});
+    }
+
+    uint64_t sum = 0;
+};
+
+// Dispatches the events through the layers from the top, like the
+// application does.
+template <typename LayerType>
+void bench_event_layer_stack(pine::bench::State& state)
+{
+    auto events = create_events();
+
+    pine::LayerStack layer_stack;
+    std::vector<LayerType*> layers;
+    for (uint32_t index = 0; index < layer_count; index++)
+    {
+        layers.push_back(new LayerType());
+        layer_stack.push_layer(layers.back());
+    }
+
+    while (state.keep_running())
+    {
+        for (auto& variant : events)
+        {
+            auto& event = get_event(variant);
+            for (auto it = layer_stack.rbegin(); it != layer_stack.rend(); ++it)
+            {
+                if (event.handled)
+                {
+                    break;
+                }
+                (*it)->on_event(event);
+            }
+        }
+    }
+
+    uint64_t sum = 0;
+    for (const auto* layer : layers)
+    {
+        sum += layer->sum;
+    }
+    state.set_items_processed(state.get_iterations() * event_count);
+    state.set_counter("checksum", static_cast<double>(sum));
+}
+
+void bench_event_dispatcher(pine::bench::State& state)
+{
+    bench_event_layer_stack<DispatcherLayer>(state);
+}
+
+void bench_event_handler_table(pine::bench::State& state)
+{
+    bench_event_layer_stack<HandlerTableLayer>(state);
+}
+
+void bench_event_visit(pine::bench::State& state)
+{
+    bench_event_layer_stack<VisitLayer>(state);
+}
+
+// Records the events into the queue and dispatches them in one batch, as the
+// window and the application do once per frame.
+void bench_event_queue(pine::bench::State& state)
+{
+    auto events = create_events();
+    pine::EventQueue queue;
+    uint64_t sum = 0;
+
+    while (state.keep_running())
+    {
+        for (auto& variant : events)
+        {
+            std::visit(
+                [&queue](auto& event)
+                {
+                    using EventType = std::decay_t<decltype(event)>;
+                    queue.push<EventType>(event);
+                },
+                variant);
+        }
+        queue.dispatch(
+            [&sum](pine::Event& event)
+            {
+                sum += static_cast<uint64_t>(event.get_event_type());
+            });
+    }
+
+    state.set_items_processed(state.get_iterations() * event_count);
+    state.set_counter("checksum", static_cast<double>(sum));
+}
+
+} // namespace
+
+PINE_BENCHMARK(bench_event_dispatcher)
+PINE_BENCHMARK(bench_event_handler_table)
+PINE_BENCHMARK(bench_event_visit)
+PINE_BENCHMARK(bench_event_queue)
@@ -0,0 +1,122 @@
+#include <filesystem>
+
+#include "harness.hpp"
+#include "pine/renderer/image.hpp"
+
+namespace
+{
+
+static constexpr uint32_t image_size = 512;
+
+const char* get_extension(const int64_t format)
+{
+    switch (static_cast<pine::ImageFileFormat>(format))
+    {
+    case pine::ImageFileFormat::JPG:
+        return ".jpg";
+    case pine::ImageFileFormat::PNG:
+        return ".png";
+    case pine::ImageFileFormat::BMP:
+        return ".bmp";
+    case pine::ImageFileFormat::TGA:
+        return ".tga";
+    case pine::ImageFileFormat::QOI:
+        return ".qoi";
+    }
+    return "";
+}
+
+// Smooth gradients with some noise, which compresses more like a real frame
+// than a constant or purely random image does.
+pine::Image make_test_image()
+{
+    std::vector<uint8_t> pixels(image_size * image_size * 4);
+    uint32_t seed = 2463534242;
+    for (uint32_t y = 0; y < image_size; y++)
+    {
+        for (uint32_t x = 0; x < image_size; x++)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            const auto noise = seed & 0x7;
+            auto* pixel = &pixels[(y * image_size + x) * 4];
+            pixel[0] = static_cast<uint8_t>(x / 2 + noise);
+            pixel[1] = static_cast<uint8_t>(y / 2 + noise);
+            pixel[2] = static_cast<uint8_t>((x + y) / 4);
+            pixel[3] = 255;
+        }
+    }
+    return pine::Image(pixels.data(),
+        image_size,
+        image_size,
+        pine::ImageFormat::RGBA);
+}
+
+std::filesystem::path get_image_path(const int64_t format)
+{
+    return std::filesystem::temp_directory_path()
+        / (std::string("pine_bench_image") + get_extension(format));
+}
+
+void bench_write_image(pine::bench::State& state)
+{
+    const auto image = make_test_image();
+    const auto path = get_image_path(state.get_arg(0));
+
+    while (state.keep_running())
+    {
+        if (!pine::write_image(path, image, false, 90))
+        {
+            state.skip("could not write " + path.string());
+            break;
+        }
+    }
+
+    state.set_bytes_processed(state.get_iterations()
+        * image.get_buffer().size());
+    state.set_counter("file_bytes",
+        static_cast<double>(std::filesystem::file_size(path)));
+}
+
+void bench_read_image(pine::bench::State& state)
+{
+    const auto image = make_test_image();
+    const auto path = get_image_path(state.get_arg(0));
+    if (!pine::write_image(path, image, false, 90))
+    {
+        state.skip("could not write " + path.string());
+        return;
+    }
+
+    while (state.keep_running())
+    {
+        const auto result = pine::read_image(path);
+        if (result.get_buffer().empty())
+        {
+            state.skip("could not read " + path.string());
+            break;
+        }
+    }
+
+    state.set_bytes_processed(state.get_iterations()
+        * image.get_buffer().size());
+}
+
+void bench_flip_image(pine::bench::State& state)
+{
+    auto image = make_test_image();
+    while (state.keep_running())
+    {
+        image.flip_vertically();
+    }
+    state.set_bytes_processed(state.get_iterations()
+        * image.get_buffer().size());
+}
+
+} // namespace
+
+// Arguments are pine::ImageFileFormat values.
+PINE_BENCHMARK_ARGS(bench_write_image, {0}, {1}, {2}, {3}, {4})
+PINE_BENCHMARK_ARGS(bench_read_image, {0}, {1}, {2}, {3})
+PINE_BENCHMARK(bench_flip_image)
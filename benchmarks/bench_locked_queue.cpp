@@ -0,0 +1,78 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "harness.hpp"
+#include "pine/utils/locked_queue.hpp"
+
+namespace
+{
+
+// Producers and consumers exchange a fixed number of items per iteration.
+void bench_locked_queue_contention(pine::bench::State& state)
+{
+    static constexpr uint64_t item_count = 100000;
+    const auto producer_count = static_cast<uint64_t>(state.get_arg(0));
+    const auto consumer_count = static_cast<uint64_t>(state.get_arg(1));
+
+    while (state.keep_running())
+    {
+        pine::LockedQueue<uint64_t> queue;
+        std::atomic<uint64_t> consumed = 0;
+
+        std::vector<std::thread> threads;
+        for (uint64_t producer = 0; producer < producer_count; producer++)
+        {
+            threads.emplace_back(
+                [&queue, producer, producer_count]()
+                {
+                    for (auto i = producer; i < item_count;
+                         i += producer_count)
+                    {
+                        queue.push_back(i);
+                    }
+                });
+        }
+
+        for (uint64_t consumer = 0; consumer < consumer_count; consumer++)
+        {
+            threads.emplace_back(
+                [&queue, &consumed]()
+                {
+                    while (consumed.load(std::memory_order_relaxed)
+                        < item_count)
+                    {
+                        if (queue.try_pop_front())
+                        {
+                            consumed.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    state.set_items_processed(state.get_iterations() * item_count);
+}
+
+void bench_locked_queue_single_thread(pine::bench::State& state)
+{
+    pine::LockedQueue<uint64_t> queue;
+    uint64_t sum = 0;
+    while (state.keep_running())
+    {
+        queue.push_back(state.get_iterations());
+        sum += queue.pop_front();
+    }
+    state.set_items_processed(state.get_iterations());
+    state.set_counter("checksum", static_cast<double>(sum));
+}
+
+} // namespace
+
+PINE_BENCHMARK(bench_locked_queue_single_thread)
+PINE_BENCHMARK_ARGS(bench_locked_queue_contention, {1, 1}, {2, 2}, {4, 4},
+    {1, 4}, {4, 1})
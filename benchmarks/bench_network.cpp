@@ -0,0 +1,94 @@
+#include <memory>
+#include <thread>
+
+#include "harness.hpp"
+#include "pine/network/client.hpp"
+#include "pine/network/server.hpp"
+
+namespace
+{
+
+struct Loopback
+{
+    std::unique_ptr<pine::ServerState> server;
+    pine::ClientState client;
+};
+
+// Starts an echo server on an ephemeral loopback port and connects a client
+// to it. The server echoes from update_server, i.e. on the calling thread.
+bool start_loopback(Loopback& loopback)
+{
+    loopback.server = std::make_unique<pine::ServerState>(0);
+    auto& server = *loopback.server;
+    server.set_connection_callback([](const pine::ConnectionState&)
+        { return true; });
+    server.set_message_callback(
+        [&server](const std::vector<uint8_t>& message)
+        {
+            pine::send_to_client(server,
+                server.connections.front(),
+                message.data(),
+                message.size());
+        });
+
+    if (!pine::start_server(server))
+    {
+        return false;
+    }
+
+    const auto port = server.acceptor.local_endpoint().port();
+    if (!pine::connect(loopback.client, "127.0.0.1", port))
+    {
+        return false;
+    }
+
+    // The connection is registered before the server starts reading from it,
+    // so a received handshake means the echo target exists.
+    const uint8_t handshake = 0;
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (server.message_queue.empty())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        pine::send(loopback.client, &handshake, sizeof(handshake));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    server.message_queue.clear();
+    loopback.client.message_queue.clear();
+    return true;
+}
+
+void bench_network_echo(pine::bench::State& state)
+{
+    const auto message_size = static_cast<uint64_t>(state.get_arg(0));
+    Loopback loopback;
+    if (!start_loopback(loopback))
+    {
+        state.skip("could not establish loopback connection");
+        return;
+    }
+
+    std::vector<uint8_t> message(message_size, 0xAB);
+    while (state.keep_running())
+    {
+        pine::send(loopback.client, message.data(), message.size());
+        while (true)
+        {
+            pine::update_server(*loopback.server);
+            if (loopback.client.message_queue.try_pop_front())
+            {
+                break;
+            }
+        }
+    }
+
+    state.set_bytes_processed(2 * state.get_iterations() * message_size);
+    state.set_items_processed(state.get_iterations());
+}
+
+} // namespace
+
+PINE_BENCHMARK_ARGS(bench_network_echo, {64}, {4096}, {65536})
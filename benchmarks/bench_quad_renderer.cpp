@@ -0,0 +1,116 @@
+#include <memory>
+
+#include "harness.hpp"
+#include "pine/renderer/quad_renderer.hpp"
+
+// Exercises the CPU side of QuadRenderer, i.e. the vertex generation. Batches
+// stay below the quad capacity so no flush, and thereby no GL call, happens.
+
+namespace
+{
+
+class NullTexture : public pine::Texture2D
+{
+public:
+    NullTexture(const pine::RendererID id) : m_id(id) {}
+
+    uint32_t get_width() const override { return 1; }
+    uint32_t get_height() const override { return 1; }
+    pine::RendererID get_renderer_id() const override { return m_id; }
+
+    void bind([[maybe_unused]] const uint32_t slot) const override {}
+    void unbind() const override {}
+
+    bool operator==(const pine::Texture& other) const override
+    {
+        return m_id == other.get_renderer_id();
+    }
+
+private:
+    pine::RendererID m_id;
+};
+
+void reset_batch(pine::QuadRenderData& data)
+{
+    data.quad_vertex_count = 0;
+    data.quad_index_count = 0;
+    data.texture_slot_index = 1;
+    data.statistics = {};
+}
+
+void bench_draw_quad(pine::bench::State& state)
+{
+    const auto quad_count = static_cast<uint32_t>(state.get_arg(0));
+    auto data = std::make_unique<pine::QuadRenderData>();
+
+    while (state.keep_running())
+    {
+        reset_batch(*data);
+        for (uint32_t i = 0; i < quad_count; i++)
+        {
+            const auto x = static_cast<float>(i % 100);
+            const auto y = static_cast<float>(i / 100);
+            pine::QuadRenderer::draw_quad(*data,
+                pine::Vec2{x, y},
+                pine::Vec2{0.5f, 0.5f},
+                pine::Vec4{0.2f, 0.3f, 0.8f, 1.0f});
+        }
+    }
+    state.set_items_processed(state.get_iterations() * quad_count);
+}
+
+void bench_draw_rotated_quad(pine::bench::State& state)
+{
+    const auto quad_count = static_cast<uint32_t>(state.get_arg(0));
+    auto data = std::make_unique<pine::QuadRenderData>();
+
+    while (state.keep_running())
+    {
+        reset_batch(*data);
+        for (uint32_t i = 0; i < quad_count; i++)
+        {
+            const auto x = static_cast<float>(i % 100);
+            const auto y = static_cast<float>(i / 100);
+            pine::QuadRenderer::draw_rotated_quad(*data,
+                pine::Vec2{x, y},
+                pine::Vec2{0.5f, 0.5f},
+                0.01f * static_cast<float>(i),
+                pine::Vec4{0.2f, 0.3f, 0.8f, 1.0f});
+        }
+    }
+    state.set_items_processed(state.get_iterations() * quad_count);
+}
+
+void bench_draw_textured_quad(pine::bench::State& state)
+{
+    const auto quad_count = static_cast<uint32_t>(state.get_arg(0));
+    const auto texture_count = static_cast<uint32_t>(state.get_arg(1));
+    auto data = std::make_unique<pine::QuadRenderData>();
+
+    std::vector<std::shared_ptr<pine::Texture2D>> textures;
+    for (uint32_t i = 0; i < texture_count; i++)
+    {
+        textures.push_back(std::make_shared<NullTexture>(i + 1));
+    }
+
+    while (state.keep_running())
+    {
+        reset_batch(*data);
+        for (uint32_t i = 0; i < quad_count; i++)
+        {
+            const auto x = static_cast<float>(i % 100);
+            const auto y = static_cast<float>(i / 100);
+            pine::QuadRenderer::draw_quad(*data,
+                pine::Vec2{x, y},
+                pine::Vec2{0.5f, 0.5f},
+                textures[i % texture_count]);
+        }
+    }
+    state.set_items_processed(state.get_iterations() * quad_count);
+}
+
+} // namespace
+
+PINE_BENCHMARK_ARGS(bench_draw_quad, {1000}, {10000})
+PINE_BENCHMARK_ARGS(bench_draw_rotated_quad, {1000}, {10000})
+PINE_BENCHMARK_ARGS(bench_draw_textured_quad, {10000, 1}, {10000, 16})
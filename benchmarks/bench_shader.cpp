@@ -0,0 +1,135 @@
+#include <array>
+
+#include "gl_context.hpp"
+#include "harness.hpp"
+#include "pine/renderer/shader.hpp"
+
+namespace
+{
+
+static constexpr auto vertex_source = R"(
+#version 450 core
+
+layout(location = 0) in vec3 a_position;
+
+uniform mat4 u_view_projection;
+uniform mat4 u_transform;
+
+void main()
+{
+    gl_Position = u_view_projection * u_transform * vec4(a_position, 1.0);
+}
+)";
+
+static constexpr auto fragment_source = R"(
+#version 450 core
+
+layout(location = 0) out vec4 o_color;
+
+uniform vec4 u_color;
+uniform sampler2D u_textures[32];
+
+void main()
+{
+    o_color = u_color * texture(u_textures[0], vec2(0.5));
+}
+)";
+
+std::unique_ptr<pine::Shader> create_shader(pine::bench::State& state)
+{
+    if (!pine::bench::make_gl_context_current())
+    {
+        state.skip("no OpenGL context");
+        return nullptr;
+    }
+
+    auto shader = pine::Shader::create("bench", vertex_source, fragment_source);
+    shader->bind();
+    return shader;
+}
+
+void bench_shader_compile(pine::bench::State& state)
+{
+    if (!pine::bench::make_gl_context_current())
+    {
+        state.skip("no OpenGL context");
+        return;
+    }
+
+    while (state.keep_running())
+    {
+        pine::Shader::create("bench", vertex_source, fragment_source);
+    }
+}
+
+// The setters skip values that match the last upload, so the benchmarks
+// alternate between two values to measure the uploads.
+void bench_shader_set_mat4(pine::bench::State& state)
+{
+    const auto shader = create_shader(state);
+    const std::array<pine::Mat4, 2> matrices = {
+        pine::Mat4(1.0f),
+        pine::Mat4(2.0f)};
+    size_t index = 0;
+    while (shader && state.keep_running())
+    {
+        shader->set_mat4("u_transform", matrices[index]);
+        index ^= 1;
+    }
+    state.set_items_processed(state.get_iterations());
+}
+
+void bench_shader_set_mat4_unchanged(pine::bench::State& state)
+{
+    const auto shader = create_shader(state);
+    const pine::Mat4 matrix(1.0f);
+    while (shader && state.keep_running())
+    {
+        shader->set_mat4("u_transform", matrix);
+    }
+    state.set_items_processed(state.get_iterations());
+}
+
+void bench_shader_set_float4(pine::bench::State& state)
+{
+    const auto shader = create_shader(state);
+    const std::array<pine::Vec4, 2> colors = {
+        pine::Vec4(1.0f, 0.5f, 0.25f, 1.0f),
+        pine::Vec4(0.25f, 0.5f, 1.0f, 1.0f)};
+    size_t index = 0;
+    while (shader && state.keep_running())
+    {
+        shader->set_float4("u_color", colors[index]);
+        index ^= 1;
+    }
+    state.set_items_processed(state.get_iterations());
+}
+
+void bench_shader_set_int_array(pine::bench::State& state)
+{
+    const auto shader = create_shader(state);
+    std::array<std::array<int, 32>, 2> samplers = {};
+    for (size_t i = 0; i < samplers[0].size(); i++)
+    {
+        samplers[0][i] = static_cast<int>(i);
+        samplers[1][i] = static_cast<int>(samplers[0].size() - 1 - i);
+    }
+
+    size_t index = 0;
+    while (shader && state.keep_running())
+    {
+        shader->set_int_array("u_textures",
+            samplers[index].data(),
+            static_cast<uint32_t>(samplers[index].size()));
+        index ^= 1;
+    }
+    state.set_items_processed(state.get_iterations());
+}
+
+} // namespace
+
+PINE_BENCHMARK(bench_shader_compile)
+PINE_BENCHMARK(bench_shader_set_mat4)
+PINE_BENCHMARK(bench_shader_set_mat4_unchanged)
+PINE_BENCHMARK(bench_shader_set_float4)
+PINE_BENCHMARK(bench_shader_set_int_array)
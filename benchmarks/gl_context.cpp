@@ -0,0 +1,56 @@
+#include "gl_context.hpp"
+
+#include <memory>
+
+#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+
+#include "harness.hpp"
+#include "pine/renderer/graphics_context.hpp"
+
+namespace pine::bench
+{
+
+static GLFWwindow* s_window = nullptr;
+static std::unique_ptr<GraphicsContext> s_context = nullptr;
+
+bool make_gl_context_current()
+{
+    static const bool initialized = []()
+    {
+        if (!glfwInit())
+        {
+            return false;
+        }
+
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        s_window = glfwCreateWindow(64, 64, "pine_bench", nullptr, nullptr);
+        if (!s_window)
+        {
+            glfwTerminate();
+            return false;
+        }
+
+        s_context = GraphicsContext::create(s_window);
+        s_context->init();
+        add_context("gl_renderer", get_gl_renderer());
+        return true;
+    }();
+
+    if (initialized)
+    {
+        glfwMakeContextCurrent(s_window);
+    }
+    return initialized;
+}
+
+std::string get_gl_renderer()
+{
+    const auto renderer = glGetString(GL_RENDERER);
+    return renderer ? reinterpret_cast<const char*>(renderer) : "unknown";
+}
+
+} // namespace pine::bench
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+
+namespace pine::bench
+{
+
+// Creates a hidden window with an OpenGL 4.5 context on first use and makes
+// it current. On machines without a GPU, run under xvfb-run with Mesa, which
+// falls back to llvmpipe. Returns false if no context could be created.
+bool make_gl_context_current();
+
+std::string get_gl_renderer();
+
+} // namespace pine::bench
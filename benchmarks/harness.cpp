@@ -0,0 +1,357 @@
+#include "harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+#include <unistd.h>
+
+namespace pine::bench
+{
+
+struct Options
+{
+    std::string filter;
+    std::string json_path;
+    double min_time = 0.2;
+    uint32_t repetitions = 3;
+    bool list = false;
+};
+
+struct Result
+{
+    std::string name;
+    uint64_t iterations = 0;
+    std::vector<double> times; // Seconds per iteration, one per repetition.
+    double bytes_per_second = 0.0;
+    double items_per_second = 0.0;
+    std::map<std::string, double> counters;
+    std::optional<std::string> skip_reason;
+};
+
+static std::vector<BenchmarkDefinition>& get_registry()
+{
+    static std::vector<BenchmarkDefinition> registry;
+    return registry;
+}
+
+static std::vector<std::pair<std::string, std::string>>& get_context()
+{
+    static std::vector<std::pair<std::string, std::string>> context;
+    return context;
+}
+
+State::State(const uint64_t iterations, const std::vector<int64_t>& args)
+    : m_iterations(iterations), m_args(args)
+{
+}
+
+int register_benchmark(const char* name, const BenchmarkFunction function,
+    const std::vector<std::vector<int64_t>>& arg_sets)
+{
+    get_registry().push_back({name, function, arg_sets});
+    return static_cast<int>(get_registry().size());
+}
+
+void add_context(const std::string& key, const std::string& value)
+{
+    auto& context = get_context();
+    const auto it = std::find_if(context.begin(),
+        context.end(),
+        [&key](const auto& entry) { return entry.first == key; });
+    if (it == context.end())
+    {
+        context.emplace_back(key, value);
+    }
+}
+
+static std::string get_full_name(const std::string& name,
+    const std::vector<int64_t>& args)
+{
+    auto full_name = name;
+    for (const auto arg : args)
+    {
+        full_name += "/" + std::to_string(arg);
+    }
+    return full_name;
+}
+
+static Result run_benchmark(const BenchmarkDefinition& definition,
+    const std::vector<int64_t>& args, const Options& options)
+{
+    Result result;
+    result.name = get_full_name(definition.name, args);
+
+    // Grow the iteration count until a single run takes at least the minimum
+    // time, then run the repetitions with that count.
+    uint64_t iterations = 1;
+    while (true)
+    {
+        State state(iterations, args);
+        definition.function(state);
+        if (state.get_skip_reason())
+        {
+            result.skip_reason = state.get_skip_reason();
+            return result;
+        }
+
+        const auto elapsed = state.get_elapsed_seconds();
+        if (elapsed >= options.min_time || iterations >= 1000000000)
+        {
+            break;
+        }
+
+        const auto scale = elapsed > 0.0 ? 1.4 * options.min_time / elapsed
+                                         : 100.0;
+        iterations = static_cast<uint64_t>(static_cast<double>(iterations)
+            * std::clamp(scale, 2.0, 100.0));
+    }
+    result.iterations = iterations;
+
+    double total_time = 0.0;
+    uint64_t total_bytes = 0;
+    uint64_t total_items = 0;
+    for (uint32_t repetition = 0; repetition < options.repetitions;
+         repetition++)
+    {
+        State state(iterations, args);
+        definition.function(state);
+
+        const auto elapsed = state.get_elapsed_seconds();
+        result.times.push_back(elapsed / static_cast<double>(iterations));
+        result.counters = state.get_counters();
+        total_time += elapsed;
+        total_bytes += state.get_bytes_processed();
+        total_items += state.get_items_processed();
+    }
+
+    if (total_time > 0.0)
+    {
+        result.bytes_per_second = static_cast<double>(total_bytes) / total_time;
+        result.items_per_second = static_cast<double>(total_items) / total_time;
+    }
+    return result;
+}
+
+static double get_mean(const std::vector<double>& values)
+{
+    return std::accumulate(values.begin(), values.end(), 0.0)
+        / static_cast<double>(values.size());
+}
+
+static double get_median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    const auto middle = values.size() / 2;
+    return values.size() % 2 ? values[middle]
+                              : (values[middle - 1] + values[middle]) / 2.0;
+}
+
+static double get_stddev(const std::vector<double>& values)
+{
+    if (values.size() < 2)
+    {
+        return 0.0;
+    }
+    const auto mean = get_mean(values);
+    double sum = 0.0;
+    for (const auto value : values)
+    {
+        sum += (value - mean) * (value - mean);
+    }
+    return std::sqrt(sum / static_cast<double>(values.size() - 1));
+}
+
+static std::string escape_json(const std::string& text)
+{
+    std::string escaped;
+    for (const auto character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(character);
+    }
+    return escaped;
+}
+
+static void print_result(const Result& result)
+{
+    if (result.skip_reason)
+    {
+        std::printf("%-48s skipped: %s\n",
+            result.name.c_str(),
+            result.skip_reason->c_str());
+        return;
+    }
+
+    std::printf("%-48s %12.1f ns %12lu",
+        result.name.c_str(),
+        get_median(result.times) * 1e9,
+        static_cast<unsigned long>(result.iterations));
+    if (result.bytes_per_second > 0.0)
+    {
+        std::printf(" %10.1f MB/s", result.bytes_per_second / 1e6);
+    }
+    if (result.items_per_second > 0.0)
+    {
+        std::printf(" %12.0f items/s", result.items_per_second);
+    }
+    for (const auto& [name, value] : result.counters)
+    {
+        std::printf(" %s=%g", name.c_str(), value);
+    }
+    std::printf("\n");
+}
+
+static void write_json(std::ostream& stream, const std::vector<Result>& results)
+{
+    std::array<char, 256> hostname = {};
+    gethostname(hostname.data(), hostname.size() - 1);
+
+    std::array<char, 32> date = {};
+    const auto now = std::time(nullptr);
+    std::strftime(date.data(),
+        date.size(),
+        "%Y-%m-%dT%H:%M:%SZ",
+        std::gmtime(&now));
+
+    stream << "{\n  \"context\": {\n";
+    stream << "    \"date\": \"" << date.data() << "\",\n";
+    stream << "    \"host\": \"" << escape_json(hostname.data()) << "\",\n";
+    stream << "    \"version\": \"" << PINE_VERSION << "\"";
+    for (const auto& [key, value] : get_context())
+    {
+        stream << ",\n    \"" << escape_json(key) << "\": \""
+               << escape_json(value) << "\"";
+    }
+    stream << "\n  },\n  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const auto& result = results[i];
+        stream << (i ? ",\n" : "\n") << "    {\"name\": \""
+               << escape_json(result.name) << "\"";
+        if (result.skip_reason)
+        {
+            stream << ", \"skipped\": \"" << escape_json(*result.skip_reason)
+                   << "\"}";
+            continue;
+        }
+
+        stream << ", \"iterations\": " << result.iterations
+               << ", \"repetitions\": " << result.times.size()
+               << ", \"mean_ns\": " << get_mean(result.times) * 1e9
+               << ", \"median_ns\": " << get_median(result.times) * 1e9
+               << ", \"min_ns\": "
+               << *std::min_element(result.times.begin(), result.times.end())
+                * 1e9
+               << ", \"stddev_ns\": " << get_stddev(result.times) * 1e9
+               << ", \"bytes_per_second\": " << result.bytes_per_second
+               << ", \"items_per_second\": " << result.items_per_second;
+        for (const auto& [name, value] : result.counters)
+        {
+            stream << ", \"" << escape_json(name) << "\": " << value;
+        }
+        stream << "}";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+static Options parse_options(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        const auto value = argument.substr(argument.find('=') + 1);
+        if (argument.rfind("--filter=", 0) == 0)
+        {
+            options.filter = value;
+        }
+        else if (argument.rfind("--json=", 0) == 0)
+        {
+            options.json_path = value;
+        }
+        else if (argument.rfind("--min-time=", 0) == 0)
+        {
+            options.min_time = std::stod(value);
+        }
+        else if (argument.rfind("--repetitions=", 0) == 0)
+        {
+            options.repetitions =
+                std::max(1u, static_cast<uint32_t>(std::stoul(value)));
+        }
+        else if (argument == "--list")
+        {
+            options.list = true;
+        }
+        else
+        {
+            std::printf("Usage: %s [--filter=<substring>] [--json=<file|->] "
+                        "[--min-time=<seconds>] [--repetitions=<count>] "
+                        "[--list]\n",
+                argv[0]);
+            std::exit(argument == "--help" ? 0 : 1);
+        }
+    }
+    return options;
+}
+
+int run_benchmarks(int argc, char** argv)
+{
+    const auto options = parse_options(argc, argv);
+
+    std::vector<Result> results;
+    for (const auto& definition : get_registry())
+    {
+        for (const auto& args : definition.arg_sets)
+        {
+            const auto name = get_full_name(definition.name, args);
+            if (name.find(options.filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            if (options.list)
+            {
+                std::printf("%s\n", name.c_str());
+                continue;
+            }
+
+            results.push_back(run_benchmark(definition, args, options));
+            if (options.json_path != "-")
+            {
+                print_result(results.back());
+            }
+        }
+    }
+
+    if (options.json_path == "-")
+    {
+        write_json(std::cout, results);
+    }
+    else if (!options.json_path.empty())
+    {
+        std::ofstream output_stream(options.json_path);
+        if (!output_stream)
+        {
+            std::fprintf(stderr,
+                "Could not open '%s'\n",
+                options.json_path.c_str());
+            return 1;
+        }
+        write_json(output_stream, results);
+    }
+
+    return 0;
+}
+
+} // namespace pine::bench
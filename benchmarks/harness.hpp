@@ -0,0 +1,117 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace pine::bench
+{
+
+class State
+{
+    /*
+    Passed to every benchmark function. The timed region is the loop body of
+    "while (state.keep_running())", setup before the loop is not measured.
+    */
+
+    using Clock = std::chrono::steady_clock;
+
+public:
+    State(const uint64_t iterations, const std::vector<int64_t>& args);
+
+    bool keep_running()
+    {
+        if (m_current == 0 && !m_skip_reason)
+        {
+            m_start = Clock::now();
+        }
+
+        if (m_current < m_iterations && !m_skip_reason)
+        {
+            m_current++;
+            return true;
+        }
+
+        m_elapsed += Clock::now() - m_start;
+        return false;
+    }
+
+    void pause_timing() { m_elapsed += Clock::now() - m_start; }
+    void resume_timing() { m_start = Clock::now(); }
+
+    int64_t get_arg(const size_t index) const { return m_args.at(index); }
+    uint64_t get_iterations() const { return m_iterations; }
+
+    void set_bytes_processed(const uint64_t bytes) { m_bytes = bytes; }
+    void set_items_processed(const uint64_t items) { m_items = items; }
+    void set_counter(const std::string& name, const double value)
+    {
+        m_counters[name] = value;
+    }
+
+    // Marks the benchmark as skipped, e.g. if a resource is unavailable.
+    void skip(const std::string& reason) { m_skip_reason = reason; }
+
+    double get_elapsed_seconds() const
+    {
+        return std::chrono::duration<double>(m_elapsed).count();
+    }
+    uint64_t get_bytes_processed() const { return m_bytes; }
+    uint64_t get_items_processed() const { return m_items; }
+    const std::map<std::string, double>& get_counters() const
+    {
+        return m_counters;
+    }
+    const std::optional<std::string>& get_skip_reason() const
+    {
+        return m_skip_reason;
+    }
+
+private:
+    uint64_t m_iterations;
+    uint64_t m_current = 0;
+    std::vector<int64_t> m_args;
+
+    Clock::time_point m_start{};
+    Clock::duration m_elapsed{};
+
+    uint64_t m_bytes = 0;
+    uint64_t m_items = 0;
+    std::map<std::string, double> m_counters;
+    std::optional<std::string> m_skip_reason;
+};
+
+using BenchmarkFunction = void (*)(State&);
+
+struct BenchmarkDefinition
+{
+    std::string name;
+    BenchmarkFunction function;
+    std::vector<std::vector<int64_t>> arg_sets;
+};
+
+int register_benchmark(const char* name, const BenchmarkFunction function,
+    const std::vector<std::vector<int64_t>>& arg_sets = {{}});
+
+// Adds a key-value pair to the context section of the report.
+void add_context(const std::string& key, const std::string& value);
+
+int run_benchmarks(int argc, char** argv);
+
+} // namespace pine::bench
+
+#define PINE_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define PINE_BENCHMARK_CONCAT(a, b) PINE_BENCHMARK_CONCAT_IMPL(a, b)
+
+#define PINE_BENCHMARK(function)                                               \
+    static const int PINE_BENCHMARK_CONCAT(registered_, __LINE__) =            \
+        ::pine::bench::register_benchmark(#function, function);
+
+// Registers a benchmark once per argument set, e.g.
+// PINE_BENCHMARK_ARGS(bench_send, {16}, {1024}).
+#define PINE_BENCHMARK_ARGS(function, ...)                                     \
+    static const int PINE_BENCHMARK_CONCAT(registered_, __LINE__) =            \
+        ::pine::bench::register_benchmark(#function, function, {__VA_ARGS__});
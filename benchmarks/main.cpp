@@ -0,0 +1,22 @@
+#include "harness.hpp"
+
+#include <string_view>
+
+#include "pine/core/log.hpp"
+
+int main(int argc, char** argv)
+{
+    pine::Log::init();
+
+    // The console log sink writes to stdout, keep it out of a JSON report.
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string_view(argv[i]) == "--json=-")
+        {
+            pine::Log::get_core_logger()->set_level(spdlog::level::off);
+            pine::Log::get_client_logger()->set_level(spdlog::level::off);
+        }
+    }
+
+    return pine::bench::run_benchmarks(argc, argv);
+}
@@ -0,0 +1,453 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pine/core/log.hpp"
+#include "pine/debug/memory_tracker.hpp"
+#include "pine/network/client.hpp"
+#include "pine/network/server.hpp"
+
+/*
+Measures the loopback throughput and latency of the network module. A server
+echoes every message back to its sender, while N clients each keep a single
+message in flight. Message sizes are swept in powers of four.
+
+Usage: pine_netbench [--clients=<count>] [--min-size=<bytes>]
+    [--max-size=<bytes>] [--bytes=<bytes per client and size>]
+    [--max-messages=<count>] [--json=<file>]
+*/
+
+// Counts every heap allocation in the process, i.e. both the client and the
+// server side of the loopback. With memory tracking enabled, pine already
+// replaces operator new, so its heap statistics are used instead.
+#if PINE_MEMORY_TRACKING
+
+static uint64_t get_allocation_count()
+{
+    return pine::MemoryTracker::get_statistics(pine::MemoryTag::HEAP)
+        .allocation_count;
+}
+
+static uint64_t get_allocation_bytes()
+{
+    return pine::MemoryTracker::get_statistics(pine::MemoryTag::HEAP)
+        .allocated_bytes;
+}
+
+#else
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static std::atomic<uint64_t> s_allocation_count = 0;
+static std::atomic<uint64_t> s_allocation_bytes = 0;
+
+void* operator new(const std::size_t size)
+{
+    s_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    s_allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (auto* pointer = std::malloc(size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(pointer);
+}
+
+static uint64_t get_allocation_count() { return s_allocation_count.load(); }
+static uint64_t get_allocation_bytes() { return s_allocation_bytes.load(); }
+
+#endif
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+enum class MessageType : uint32_t
+{
+    HANDSHAKE = 0,
+    PAYLOAD = 1
+};
+
+// Prefix of every message, the rest is payload.
+struct MessageHeader
+{
+    MessageType type;
+    uint32_t client;
+    uint64_t sequence;
+};
+
+struct Options
+{
+    uint32_t clients = 1;
+    uint64_t min_size = sizeof(MessageHeader);
+    uint64_t max_size = 16 * 1024 * 1024;
+    uint64_t bytes = 64 * 1024 * 1024;
+    uint64_t max_messages = 10000;
+    std::string json_path;
+};
+
+struct SizeResult
+{
+    uint64_t size = 0;
+    uint64_t messages = 0;
+    double seconds = 0.0;
+    std::vector<double> latencies; // Round-trip times in microseconds.
+    uint64_t allocation_count = 0;
+    uint64_t allocation_bytes = 0;
+};
+
+MessageHeader read_header(const std::vector<uint8_t>& message)
+{
+    MessageHeader header{};
+    if (message.size() >= sizeof(header))
+    {
+        std::memcpy(&header, message.data(), sizeof(header));
+    }
+    return header;
+}
+
+void write_header(std::vector<uint8_t>& message, const MessageHeader& header)
+{
+    std::memcpy(message.data(), &header, sizeof(header));
+}
+
+double get_percentile(const std::vector<double>& sorted, const double fraction)
+{
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+    const auto index = static_cast<size_t>(
+        fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+bool parse_options(int argc, char** argv, Options& options)
+{
+    for (int index = 1; index < argc; index++)
+    {
+        const std::string argument = argv[index];
+        const auto value = argument.substr(argument.find('=') + 1);
+        if (argument.rfind("--clients=", 0) == 0)
+        {
+            options.clients =
+                std::max(1u, static_cast<uint32_t>(std::stoul(value)));
+        }
+        else if (argument.rfind("--min-size=", 0) == 0)
+        {
+            options.min_size =
+                std::max<uint64_t>(sizeof(MessageHeader), std::stoull(value));
+        }
+        else if (argument.rfind("--max-size=", 0) == 0)
+        {
+            options.max_size = std::stoull(value);
+        }
+        else if (argument.rfind("--bytes=", 0) == 0)
+        {
+            options.bytes = std::stoull(value);
+        }
+        else if (argument.rfind("--max-messages=", 0) == 0)
+        {
+            options.max_messages = std::max<uint64_t>(1, std::stoull(value));
+        }
+        else if (argument.rfind("--json=", 0) == 0)
+        {
+            options.json_path = value;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Connects the clients one at a time. A client is only started once the
+// server has received its handshake, which means that the server connection
+// with index i belongs to client i.
+bool connect_clients(pine::ServerState& server,
+    std::vector<std::unique_ptr<pine::ClientState>>& clients,
+    const uint16_t port)
+{
+    std::vector<bool> handshakes(clients.size(), false);
+    server.set_message_callback(
+        [&handshakes](const std::vector<uint8_t>& message)
+        {
+            const auto header = read_header(message);
+            if (header.type == MessageType::HANDSHAKE
+                && header.client < handshakes.size())
+            {
+                handshakes[header.client] = true;
+            }
+        });
+
+    for (uint32_t index = 0; index < clients.size(); index++)
+    {
+        auto& client = *clients[index];
+        if (!pine::connect(client, "127.0.0.1", port))
+        {
+            return false;
+        }
+
+        std::vector<uint8_t> handshake(sizeof(MessageHeader));
+        write_header(handshake, {MessageType::HANDSHAKE, index, 0});
+
+        const auto deadline = Clock::now() + std::chrono::seconds(5);
+        while (!handshakes[index])
+        {
+            if (Clock::now() > deadline)
+            {
+                PINE_ERROR("Client {0} could not connect.", index);
+                return false;
+            }
+            pine::send(client, handshake.data(), handshake.size());
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            pine::update_server(server);
+        }
+    }
+
+    // Discard duplicate handshakes.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    pine::update_server(server);
+    for (auto& client : clients)
+    {
+        client->message_queue.clear();
+    }
+    return true;
+}
+
+SizeResult run_size(pine::ServerState& server,
+    std::vector<std::unique_ptr<pine::ClientState>>& clients,
+    const uint64_t size, const uint64_t message_count)
+{
+    server.set_message_callback(
+        [&server](const std::vector<uint8_t>& message)
+        {
+            const auto header = read_header(message);
+            if (header.type == MessageType::PAYLOAD
+                && header.client < server.connections.size())
+            {
+                pine::send_to_client(server,
+                    server.connections[header.client],
+                    message.data(),
+                    message.size());
+            }
+        });
+
+    std::vector<std::vector<double>> latencies(clients.size());
+    std::atomic<uint32_t> finished = 0;
+
+    const auto allocation_count = get_allocation_count();
+    const auto allocation_bytes = get_allocation_bytes();
+    const auto start = Clock::now();
+
+    std::vector<std::thread> threads;
+    for (uint32_t index = 0; index < clients.size(); index++)
+    {
+        threads.emplace_back(
+            [&, index]()
+            {
+                auto& client = *clients[index];
+                auto& client_latencies = latencies[index];
+                client_latencies.reserve(message_count);
+
+                std::vector<uint8_t> message(size, 0xAB);
+                for (uint64_t sequence = 0; sequence < message_count;
+                     sequence++)
+                {
+                    write_header(message,
+                        {MessageType::PAYLOAD, index, sequence});
+
+                    const auto send_time = Clock::now();
+                    pine::send(client, message.data(), message.size());
+                    while (!client.message_queue.try_pop_front())
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    const std::chrono::duration<double, std::micro>
+                        latency = Clock::now() - send_time;
+                    client_latencies.push_back(latency.count());
+                }
+                finished++;
+            });
+    }
+
+    // The server dispatches on this thread, like an application would from
+    // its update loop.
+    while (finished < clients.size())
+    {
+        if (server.message_queue.empty())
+        {
+            std::this_thread::yield();
+        }
+        pine::update_server(server);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    SizeResult result;
+    result.size = size;
+    result.messages = message_count * clients.size();
+    result.seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    result.allocation_count = get_allocation_count() - allocation_count;
+    result.allocation_bytes = get_allocation_bytes() - allocation_bytes;
+    for (const auto& client_latencies : latencies)
+    {
+        result.latencies.insert(result.latencies.end(),
+            client_latencies.begin(),
+            client_latencies.end());
+    }
+    std::sort(result.latencies.begin(), result.latencies.end());
+    return result;
+}
+
+void print_result(const SizeResult& result)
+{
+    const auto messages = static_cast<double>(result.messages);
+    std::printf("%10lu %8lu %12.0f %10.1f %10.1f %10.1f %10.1f %10.1f "
+                "%8.1f %12.0f\n",
+        static_cast<unsigned long>(result.size),
+        static_cast<unsigned long>(result.messages),
+        messages / result.seconds,
+        messages * static_cast<double>(result.size) / result.seconds / 1e6,
+        get_percentile(result.latencies, 0.5),
+        get_percentile(result.latencies, 0.9),
+        get_percentile(result.latencies, 0.99),
+        result.latencies.empty() ? 0.0 : result.latencies.back(),
+        static_cast<double>(result.allocation_count) / messages,
+        static_cast<double>(result.allocation_bytes) / messages);
+}
+
+bool write_json(const std::string& path, const Options& options,
+    const std::vector<SizeResult>& results)
+{
+    std::ofstream stream(path);
+    if (!stream)
+    {
+        return false;
+    }
+
+    stream << "{\n  \"clients\": " << options.clients << ",\n  \"sizes\": [";
+    for (size_t index = 0; index < results.size(); index++)
+    {
+        const auto& result = results[index];
+        const auto messages = static_cast<double>(result.messages);
+        stream << (index ? ",\n" : "\n") << "    {\"size\": " << result.size
+               << ", \"messages\": " << result.messages
+               << ", \"messages_per_second\": " << messages / result.seconds
+               << ", \"mb_per_second\": "
+               << messages * static_cast<double>(result.size) / result.seconds
+                / 1e6
+               << ", \"latency_p50_us\": "
+               << get_percentile(result.latencies, 0.5)
+               << ", \"latency_p90_us\": "
+               << get_percentile(result.latencies, 0.9)
+               << ", \"latency_p99_us\": "
+               << get_percentile(result.latencies, 0.99)
+               << ", \"latency_max_us\": "
+               << (result.latencies.empty() ? 0.0 : result.latencies.back())
+               << ", \"allocations_per_message\": "
+               << static_cast<double>(result.allocation_count) / messages
+               << ", \"allocated_bytes_per_message\": "
+               << static_cast<double>(result.allocation_bytes) / messages
+               << "}";
+    }
+    stream << "\n  ]\n}\n";
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    pine::Log::init();
+
+    Options options;
+    if (!parse_options(argc, argv, options))
+    {
+        PINE_ERROR("Usage: pine_netbench [--clients=<count>] "
+                   "[--min-size=<bytes>] [--max-size=<bytes>] "
+                   "[--bytes=<bytes per client and size>] "
+                   "[--max-messages=<count>] [--json=<file>]");
+        return 1;
+    }
+
+    // Bind to an ephemeral port, so that concurrent runs do not collide.
+    pine::ServerState server(0);
+    server.set_connection_callback(
+        [](const pine::ConnectionState&) { return true; });
+    if (!pine::start_server(server))
+    {
+        return 1;
+    }
+    const auto port = server.acceptor.local_endpoint().port();
+
+    std::vector<std::unique_ptr<pine::ClientState>> clients;
+    for (uint32_t index = 0; index < options.clients; index++)
+    {
+        clients.push_back(std::make_unique<pine::ClientState>());
+    }
+
+    if (!connect_clients(server, clients, port))
+    {
+        return 1;
+    }
+
+    std::printf("%10s %8s %12s %10s %10s %10s %10s %10s %8s %12s\n",
+        "size",
+        "messages",
+        "messages/s",
+        "MB/s",
+        "p50 us",
+        "p90 us",
+        "p99 us",
+        "max us",
+        "allocs",
+        "alloc bytes");
+
+    std::vector<SizeResult> results;
+    for (auto size = options.min_size; size <= options.max_size; size *= 4)
+    {
+        const auto message_count = std::clamp<uint64_t>(options.bytes / size,
+            8,
+            options.max_messages);
+        results.push_back(run_size(server, clients, size, message_count));
+        print_result(results.back());
+    }
+
+    for (auto& client : clients)
+    {
+        pine::disconnect(*client);
+    }
+    pine::stop_server(server);
+
+    if (!options.json_path.empty()
+        && !write_json(options.json_path, options, results))
+    {
+        PINE_ERROR("Could not write {0}", options.json_path);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+// Signed Distance Circle Shader
+
+#type vertex
+#version 450 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_LocalPosition;
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in float a_Thickness;
+layout(location = 4) in float a_Fade;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+};
+
+out vec2 v_LocalPosition;
+out vec4 v_Color;
+out float v_Thickness;
+out float v_Fade;
+
+void main()
+{
+    v_LocalPosition = a_LocalPosition;
+    v_Color = a_Color;
+    v_Thickness = a_Thickness;
+    v_Fade = a_Fade;
+
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_LocalPosition;
+in vec4 v_Color;
+in float v_Thickness;
+in float v_Fade;
+
+void main()
+{
+    // Distance from the edge towards the center, as a fraction of the radius.
+    float distance = 1.0 - length(v_LocalPosition);
+    float alpha = smoothstep(0.0, v_Fade, distance);
+    alpha *= smoothstep(v_Thickness + v_Fade, v_Thickness, distance);
+
+    if (alpha == 0.0)
+        discard;
+
+    color = vec4(v_Color.rgb, v_Color.a * alpha);
+}
@@ -0,0 +1,48 @@
+// Screen Space Line Shader
+
+#type vertex
+#version 450 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec3 a_OtherPosition;
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in float a_Side;
+layout(location = 4) in float a_Width;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+};
+
+out vec4 v_Color;
+
+void main()
+{
+    v_Color = a_Color;
+
+    vec4 position = u_ViewProjection * vec4(a_Position, 1.0);
+    vec4 other_position = u_ViewProjection * vec4(a_OtherPosition, 1.0);
+
+    // Expand the line along its normal in pixels, half the width to each side.
+    vec2 screen = position.xy / position.w * u_ViewportSize;
+    vec2 other_screen = other_position.xy / other_position.w * u_ViewportSize;
+    vec2 delta = other_screen - screen;
+    vec2 direction = length(delta) > 0.0 ? normalize(delta) : vec2(1.0, 0.0);
+    vec2 normal = vec2(-direction.y, direction.x);
+    vec2 offset = normal * a_Side * a_Width / max(u_ViewportSize, vec2(1.0));
+
+    gl_Position = position + vec4(offset * position.w, 0.0, 0.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+    color = v_Color;
+}
@@ -0,0 +1,63 @@
+// Indirect Mesh Shader
+
+#type vertex
+#version 450 core
+// Core in 4.6, and widely supported by 4.5 drivers.
+#extension GL_ARB_shader_draw_parameters : require
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec3 a_Normal;
+layout(location = 2) in vec4 a_Color;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+};
+
+struct DrawData
+{
+    mat4 transform;
+    vec4 color;
+};
+
+layout(std430, binding = 0) readonly buffer Draws
+{
+    DrawData u_Draws[];
+};
+
+out vec4 v_Color;
+out vec3 v_Normal;
+
+void main()
+{
+    // The base instance of each indirect command points at its draw data.
+    DrawData draw = u_Draws[gl_BaseInstanceARB + gl_InstanceID];
+
+    v_Color = a_Color * draw.color;
+    v_Normal = mat3(draw.transform) * a_Normal;
+
+    gl_Position = u_ViewProjection * draw.transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec3 v_Normal;
+
+void main()
+{
+    // Points have no normals, and are not shaded.
+    float shading = 1.0;
+    if (dot(v_Normal, v_Normal) > 0.0)
+    {
+        vec3 light_direction = normalize(vec3(0.4, 0.8, 0.5));
+        float diffuse = max(dot(normalize(v_Normal), light_direction), 0.0);
+        shading = 0.3 + 0.7 * diffuse;
+    }
+
+    color = vec4(v_Color.rgb * shading, v_Color.a);
+}
@@ -0,0 +1,127 @@
+// Point Cloud Culling Shader
+
+#type compute
+#version 450 core
+
+// Matches PointCloudRenderCaps::workgroup_size.
+layout(local_size_x = 64) in;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+};
+
+struct Node
+{
+    vec3 min;
+    float spacing;
+    vec3 max;
+    uint parent;
+    uint first_point;
+    uint point_count;
+};
+
+struct DrawCommand
+{
+    uint count;
+    uint instance_count;
+    uint first;
+    uint base_instance;
+};
+
+layout(std430, binding = 1) readonly buffer Nodes
+{
+    Node u_Nodes[];
+};
+
+layout(std430, binding = 2) buffer Refine
+{
+    uint u_Refine[];
+};
+
+layout(std430, binding = 3) buffer Counter
+{
+    uint u_PointCount;
+};
+
+layout(std430, binding = 4) writeonly buffer Commands
+{
+    DrawCommand u_Commands[];
+};
+
+uniform vec3 u_CameraPosition;
+uniform float u_ProjectionScale;
+uniform float u_ErrorThreshold;
+uniform int u_PointBudget;
+uniform int u_FirstNode;
+uniform int u_NodeCount;
+
+const uint c_InvalidNode = 0xffffffffu;
+
+// Tests the box against the planes of the view frustum, which are the sums
+// and differences of the rows of the view projection matrix.
+bool is_visible(vec3 box_min, vec3 box_max)
+{
+    mat4 rows = transpose(u_ViewProjection);
+    vec4 planes[6] = vec4[6](rows[3] + rows[0],
+        rows[3] - rows[0],
+        rows[3] + rows[1],
+        rows[3] - rows[1],
+        rows[3] + rows[2],
+        rows[3] - rows[2]);
+
+    for (int i = 0; i < 6; i++)
+    {
+        // The corner of the box that is furthest along the plane normal.
+        bvec3 is_positive = greaterThan(planes[i].xyz, vec3(0.0));
+        vec3 corner = mix(box_min, box_max, is_positive);
+        if (dot(planes[i].xyz, corner) + planes[i].w < 0.0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Spacing of the points of the node on screen, in pixels.
+float get_screen_space_error(Node node)
+{
+    vec3 closest = clamp(u_CameraPosition, node.min, node.max);
+    float distance = max(length(closest - u_CameraPosition), 1e-4);
+    float pixels_per_unit =
+        0.5 * u_ViewportSize.y * u_ProjectionScale / distance;
+    return node.spacing * pixels_per_unit;
+}
+
+void main()
+{
+    if (gl_GlobalInvocationID.x >= uint(u_NodeCount))
+    {
+        return;
+    }
+
+    uint index = uint(u_FirstNode) + gl_GlobalInvocationID.x;
+    Node node = u_Nodes[index];
+
+    // A node is drawn if its parent was refined, which requires the parent
+    // to be drawn as well.
+    bool is_parent_refined =
+        node.parent == c_InvalidNode || u_Refine[node.parent] != 0u;
+    bool selected = is_parent_refined && is_visible(node.min, node.max);
+
+    // Nodes that do not fit in the budget are dropped with their subtrees.
+    if (selected)
+    {
+        uint first = atomicAdd(u_PointCount, node.point_count);
+        selected = first + node.point_count <= uint(u_PointBudget);
+    }
+
+    bool refine = selected && get_screen_space_error(node) > u_ErrorThreshold;
+    u_Refine[index] = refine ? 1u : 0u;
+
+    u_Commands[index] = DrawCommand(selected ? node.point_count : 0u,
+        1u,
+        node.first_point,
+        0u);
+}
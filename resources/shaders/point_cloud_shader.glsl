@@ -0,0 +1,33 @@
+// Point Cloud Shader
+
+#type vertex
+#version 450 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in uint a_Color;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+};
+
+out vec4 v_Color;
+
+void main()
+{
+    v_Color = unpackUnorm4x8(a_Color);
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+
+void main()
+{
+    color = v_Color;
+}
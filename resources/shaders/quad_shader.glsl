@@ -9,7 +9,11 @@ layout(location = 2) in vec2 a_TexCoord;
 layout(location = 3) in uint a_TexIndex;
 layout(location = 4) in float a_TilingFactor;
 
-uniform mat4 u_ViewProjection;
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+};
 
 out vec4 v_Color;
 out vec2 v_TexCoord;
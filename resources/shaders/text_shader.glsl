@@ -0,0 +1,49 @@
+// Signed Distance Field Text Shader
+
+#type vertex
+#version 450 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+layout(location = 2) in vec2 a_TexCoord;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+};
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+
+void main()
+{
+    v_Color = a_Color;
+    v_TexCoord = a_TexCoord;
+
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+
+layout(binding = 0) uniform sampler2D u_FontAtlas;
+
+void main()
+{
+    // The edge of the glyph is at half the distance range. Smoothing over
+    // the screen space derivative keeps the edge about one pixel wide.
+    float distance = texture(u_FontAtlas, v_TexCoord).r;
+    float width = fwidth(distance);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+
+    if (alpha == 0.0)
+        discard;
+
+    color = vec4(v_Color.rgb, v_Color.a * alpha);
+}
@@ -0,0 +1,61 @@
+// Tilemap Chunk Shader
+
+#type vertex
+#version 450 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+    vec2 u_ViewportSize;
+};
+
+uniform mat4 u_Transform;
+
+out vec2 v_TexCoord;
+
+void main()
+{
+    v_TexCoord = a_TexCoord;
+    gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_TexCoord;
+
+layout(binding = 0) uniform sampler2D u_Tileset;
+layout(binding = 1) uniform usampler2D u_Tiles;
+
+uniform int u_TilesetColumns;
+uniform int u_TilesetRows;
+
+void main()
+{
+    // Position in tiles within the chunk.
+    vec2 tile_position = v_TexCoord * vec2(textureSize(u_Tiles, 0));
+    ivec2 tile = ivec2(floor(tile_position));
+
+    uint index = texelFetch(u_Tiles, tile, 0).r;
+    if (index == 0u)
+        discard;
+
+    // Tile index n is cell n - 1 of the tileset, row by row.
+    int cell = int(index) - 1;
+    vec2 cell_position = vec2(cell % u_TilesetColumns, cell / u_TilesetColumns);
+    vec2 tileset_size = vec2(u_TilesetColumns, u_TilesetRows);
+
+    // The texture coordinates are continuous within a tile, so the gradients
+    // of the tile position are used to avoid seams between tiles.
+    vec2 tile_coordinates =
+        (cell_position + fract(tile_position)) / tileset_size;
+    color = textureGrad(u_Tileset,
+        tile_coordinates,
+        dFdx(tile_position) / tileset_size,
+        dFdy(tile_position) / tileset_size);
+}
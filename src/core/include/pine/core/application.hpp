@@ -1,9 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <string>
 
 #include "pine/core/common.hpp"
+#include "pine/core/frame_limiter.hpp"
+#include "pine/core/job_system.hpp"
 #include "pine/core/layer.hpp"
 #include "pine/core/timestep.hpp"
 #include "pine/core/window.hpp"
@@ -11,6 +15,7 @@
 #include "pine/events/application_event.hpp"
 #include "pine/events/event.hpp"
 
+#include "pine/renderer/render_thread.hpp"
 #include "pine/renderer/renderer.hpp"
 
 #include "pine/gui/graphical_interface.hpp"
@@ -20,6 +25,12 @@ int main(int argc, char** argv);
 namespace pine
 {
 
+enum class LoopMode : uint8_t
+{
+    VARIABLE, // Layers update once per frame.
+    FIXED // Layers also run fixed updates at the tick rate.
+};
+
 struct ApplicationSpecs
 {
     std::string name = "Default App";
@@ -32,6 +43,32 @@ struct ApplicationSpecs
     bool start_maximized = true;
     bool resizable = true;
     bool enable_gui = true;
+
+    LoopMode loop_mode = LoopMode::VARIABLE;
+    double tick_rate = 60.0;
+    // Fixed updates per frame, excess simulation time beyond it is dropped.
+    uint32_t max_catch_up_steps = 5;
+
+    // Frame rate cap, zero means uncapped. Applies on top of vsync.
+    double target_fps = 0.0;
+    // Only render frames after events or calls to request_redraw, and block
+    // on events in between.
+    bool render_on_demand = false;
+    // Longest wait for events in seconds when idle or minimized. Layers are
+    // not updated on a timeout, so layers that poll, e.g. the network, have to
+    // call request_redraw.
+    double idle_timeout = 0.5;
+
+    // Execute render commands on a dedicated thread that owns the graphics
+    // context, one frame behind the main thread. Layers must then render
+    // through RenderCommand, the QuadRenderer or RenderCommand::enqueue, and
+    // create GPU resources in on_attach. Graphics calls made directly while
+    // the render thread runs assert. Disables GUI viewports.
+    bool threaded_rendering = false;
+
+    // Worker threads of the job system, zero means one per core except for
+    // the main thread.
+    uint32_t worker_count = 0;
 };
 
 class Application
@@ -44,6 +81,10 @@ public:
     void run();
     void close();
 
+    // Makes the application render at least one more frame when rendering on
+    // demand. May be called from any thread.
+    void request_redraw();
+
     virtual void on_init() {}
     virtual void on_shutdown() {}
     virtual void on_update() {}
@@ -62,6 +103,7 @@ public:
     { 
         return *gui; 
     }
+    inline JobSystem& get_job_system() const { return *job_system; }
     
     static inline Application& get() { return *instance; }
 
@@ -71,6 +113,10 @@ public:
     }
 
 private:
+    float run_fixed_updates(const double frame_time);
+    // True when rendering on demand without a pending redraw.
+    bool is_idle() const;
+
     bool on_window_close(WindowCloseEvent& event);
     bool on_window_resize(WindowResizeEvent& event);
     bool on_window_iconify(WindowIconifyEvent& event);
@@ -80,12 +126,19 @@ private:
 
     std::unique_ptr<Window> window;
     std::unique_ptr<GraphicalInterface> gui;
+    std::unique_ptr<RenderThread> render_thread;
 
     LayerStack layer_stack;
+    // Destroyed before the layers, so pending jobs may still refer to them.
+    std::unique_ptr<JobSystem> job_system;
 
     bool running = true;
     bool minimized = false;
-    float last_frame_time = 0.0f;
+    std::chrono::steady_clock::time_point last_frame_time;
+    double tick_accumulator = 0.0;
+
+    FrameLimiter frame_limiter;
+    std::atomic<uint32_t> redraw_frames = 1;
 
     static Application* instance;
 };
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace pine
+{
+
+class ChunkedArena
+{
+    /*
+    Bump allocator over chunks of memory. Resetting releases all allocations
+    at once and keeps the chunks for reuse, so the arena stops allocating from
+    the heap once it has grown to fit its largest use, e.g. one frame.
+    */
+
+    struct Chunk
+    {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+public:
+    ChunkedArena(const size_t chunk_size);
+    ~ChunkedArena() = default;
+
+    ChunkedArena(const ChunkedArena&) = delete;
+    ChunkedArena(ChunkedArena&&) = delete;
+
+    ChunkedArena& operator=(const ChunkedArena&) = delete;
+    ChunkedArena& operator=(ChunkedArena&&) = delete;
+
+    // Returns memory that stays valid until the arena is reset. The alignment
+    // must be a power of two.
+    void* allocate(const size_t size,
+        const size_t alignment = alignof(std::max_align_t));
+
+    // Releases all allocations, the chunks are kept.
+    void reset();
+
+    // Chunks are never freed, so this is also the number of heap allocations.
+    size_t get_chunk_count() const { return m_chunks.size(); }
+    size_t get_capacity() const { return m_capacity; }
+
+private:
+    size_t m_chunk_size;
+    std::vector<Chunk> m_chunks;
+    size_t m_chunk_index = 0;
+    size_t m_chunk_offset = 0;
+    size_t m_capacity = 0;
+};
+
+} // namespace pine
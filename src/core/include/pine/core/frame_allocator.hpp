@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "pine/core/chunked_arena.hpp"
+
+namespace pine
+{
+
+class FrameAllocator : public std::pmr::memory_resource
+{
+    /*
+    Per-thread bump allocator for memory that lives until the end of the
+    frame. Deallocation is a no-op, all memory is released at once when the
+    thread first allocates after a frame boundary. Memory is kept in chunks
+    that are reused between frames, so the allocator stops allocating from the
+    heap once it has grown to fit a frame.
+
+    Usable with standard containers through std::pmr, e.g.
+    std::pmr::vector<int> values(&FrameAllocator::get());
+    */
+
+public:
+    struct Statistics
+    {
+        // Of the current frame.
+        uint64_t allocation_count = 0;
+        uint64_t allocated_bytes = 0;
+        // Chunks allocated from the heap since the allocator was created.
+        uint64_t heap_allocation_count = 0;
+        uint64_t capacity = 0;
+    };
+
+public:
+    FrameAllocator(const size_t chunk_size = 64 * 1024);
+    ~FrameAllocator() = default;
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator(FrameAllocator&&) = delete;
+
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(FrameAllocator&&) = delete;
+
+    // Releases all memory of the frame, the chunks are kept.
+    void reset();
+
+    const Statistics& get_statistics() const { return m_statistics; }
+
+    // Allocator of the calling thread.
+    static FrameAllocator& get();
+
+    // Marks a frame boundary for the allocators of all threads, and resets
+    // the one of the calling thread. Called by the application at the start
+    // of every frame.
+    static void begin_frame();
+
+    static uint64_t get_frame_index();
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other)
+        const noexcept override;
+
+private:
+    ChunkedArena m_arena;
+
+    uint64_t m_frame_index = 0;
+    Statistics m_statistics;
+};
+
+template <typename T>
+using FrameVector = std::pmr::vector<T>;
+using FrameString = std::pmr::string;
+
+} // namespace pine
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace pine
+{
+
+class FrameLimiter
+{
+    /*
+    Paces a loop to a target frame rate. The limiter sleeps in short steps
+    while the remaining frame time exceeds the observed duration of such a
+    step, and spins for the rest, since sleeps routinely overshoot by a
+    millisecond or more.
+    */
+
+    using Clock = std::chrono::steady_clock;
+
+public:
+    FrameLimiter(const double target_fps = 0.0);
+
+    // A target of zero disables the limiter.
+    void set_target_fps(const double target_fps);
+    double get_target_fps() const { return m_target_fps; }
+
+    // Blocks until the start of the next frame.
+    void wait();
+
+private:
+    void update_sleep_estimate(const double duration);
+
+private:
+    double m_target_fps = 0.0;
+    Clock::duration m_period{};
+    Clock::time_point m_next_frame{};
+
+    // Running mean and variance of the duration of a sleep step in seconds.
+    double m_sleep_estimate = 0.002;
+    double m_sleep_mean = 0.002;
+    double m_sleep_m2 = 0.0;
+    uint64_t m_sleep_count = 1;
+};
+
+} // namespace pine
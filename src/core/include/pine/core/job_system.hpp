@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pine
+{
+
+class JobCounter;
+
+struct Job
+{
+    std::function<void()> function;
+    JobCounter* counter = nullptr;
+};
+
+class JobCounter
+{
+    /*
+    Counts the unfinished jobs that were scheduled with it, for fork/join
+    style waiting and for dependencies between jobs.
+    */
+
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter(JobCounter&&) = delete;
+
+    JobCounter& operator=(const JobCounter&) = delete;
+    JobCounter& operator=(JobCounter&&) = delete;
+
+    bool is_done() const
+    {
+        return m_count.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class JobSystem;
+
+    // Set by the last job while it hands over the continuations, so that
+    // waiters keep the counter alive until the job is done with it.
+    static constexpr uint32_t s_finishing = 1u << 31;
+
+    std::atomic<uint32_t> m_count = 0;
+
+    // Jobs that start once the count reaches zero.
+    std::mutex m_mutex;
+    std::vector<Job*> m_continuations;
+};
+
+class WorkStealingDeque
+{
+    /*
+    Chase-Lev deque. The owning thread pushes and pops at the bottom, other
+    threads steal from the top. Based on "Correct and Efficient Work-Stealing
+    for Weak Memory Models" by Lê et al.
+    */
+
+    struct Array
+    {
+        int64_t capacity;
+        std::unique_ptr<std::atomic<Job*>[]> jobs;
+
+        Array(const int64_t size)
+            : capacity(size),
+              jobs(std::make_unique<std::atomic<Job*>[]>(
+                  static_cast<size_t>(size)))
+        {
+        }
+
+        Job* get(const int64_t index) const
+        {
+            return jobs[static_cast<size_t>(index & (capacity - 1))].load(
+                std::memory_order_relaxed);
+        }
+
+        void put(const int64_t index, Job* job)
+        {
+            jobs[static_cast<size_t>(index & (capacity - 1))].store(job,
+                std::memory_order_relaxed);
+        }
+    };
+
+public:
+    WorkStealingDeque(const int64_t capacity = 1024);
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    // Owner only.
+    void push(Job* job);
+    Job* pop();
+
+    // Any thread.
+    Job* steal();
+
+    bool empty() const;
+
+private:
+    Array* grow(Array* array, const int64_t bottom, const int64_t top);
+
+private:
+    std::atomic<int64_t> m_top = 0;
+    std::atomic<int64_t> m_bottom = 0;
+    std::atomic<Array*> m_array;
+
+    // Arrays are kept until destruction, as thieves may still read them.
+    std::vector<std::unique_ptr<Array>> m_arrays;
+};
+
+class JobSystem
+{
+    /*
+    Fixed pool of worker threads with one work-stealing deque each. The
+    thread that creates the job system also gets a deque, and helps out with
+    jobs while waiting. Jobs submitted from other threads go through a shared
+    queue.
+    */
+
+public:
+    // A worker count of zero uses one worker per core, except for the
+    // creating thread.
+    JobSystem(const uint32_t worker_count = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+
+    // Schedules a job. The counter is incremented immediately and decremented
+    // once the job has finished.
+    void execute(std::function<void()> function, JobCounter* counter = nullptr);
+
+    // Schedules a job that starts once all the jobs of the dependency have
+    // finished.
+    void execute_after(JobCounter& dependency, std::function<void()> function,
+        JobCounter* counter = nullptr);
+
+    // Blocks until the counter reaches zero, running other jobs meanwhile.
+    void wait(const JobCounter& counter);
+
+    // Calls function(index) for each index in [begin, end), in batches of
+    // batch_size indices per job, and waits for all of them.
+    template <typename Func>
+    void parallel_for(const uint32_t begin, const uint32_t end,
+        const uint32_t batch_size, const Func& function)
+    {
+        JobCounter counter;
+        const auto step = std::max(batch_size, 1u);
+        for (auto batch_begin = begin; batch_begin < end; batch_begin += step)
+        {
+            const auto batch_end =
+                batch_begin + std::min(step, end - batch_begin);
+            execute(
+                [&function, batch_begin, batch_end]()
+                {
+                    for (auto index = batch_begin; index < batch_end; index++)
+                    {
+                        function(index);
+                    }
+                },
+                &counter);
+        }
+        wait(counter);
+    }
+
+    uint32_t get_worker_count() const
+    {
+        return static_cast<uint32_t>(m_workers.size());
+    }
+
+private:
+    void schedule(Job* job);
+    void run_job(Job* job);
+    void finish_job(JobCounter& counter);
+
+    Job* find_job(const uint32_t thread_index);
+    void worker_loop(const uint32_t thread_index);
+
+private:
+    std::vector<std::thread> m_workers;
+    // One per worker, plus one for the creating thread.
+    std::vector<std::unique_ptr<WorkStealingDeque>> m_deques;
+
+    std::mutex m_shared_mutex;
+    std::deque<Job*> m_shared_jobs;
+
+    std::atomic<int64_t> m_queued_jobs = 0;
+    std::atomic<uint32_t> m_sleeping_workers = 0;
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_sleep_condition;
+    std::atomic<bool> m_stop = false;
+};
+
+} // namespace pine
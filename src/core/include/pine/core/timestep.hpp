@@ -6,15 +6,24 @@ namespace pine
 class Timestep
 {
 public:
-    Timestep(float time = 0.0f) : m_time(time) {}
+    Timestep(float time = 0.0f, float alpha = 1.0f)
+        : m_time(time), m_alpha(alpha)
+    {
+    }
 
     operator float() const { return m_time; }
 
     float get_seconds() const { return m_time; }
     float get_milliseconds() const { return m_time * 1000.0f; }
 
+    // Fraction of a fixed tick that has elapsed since the last fixed update,
+    // for interpolating between the two latest simulation states. Always one
+    // when the application does not run with a fixed tick rate.
+    float get_alpha() const { return m_alpha; }
+
 private:
     float m_time;
+    float m_alpha;
 };
 
 } // namespace pine
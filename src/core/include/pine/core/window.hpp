@@ -5,7 +5,8 @@
 #include <utility>
 
 #include "pine/core/common.hpp"
-#include "pine/events/event.hpp"
+#include "pine/events/event_queue.hpp"
+#include "pine/renderer/graphics_context.hpp"
 
 namespace pine
 {
@@ -26,12 +27,14 @@ class Window
     */
 
 public:
-    using EventCallbackFn = std::function<void(Event&)>;
-
     virtual ~Window() = default;
 
     virtual void init() = 0;
     virtual void poll_events() = 0;
+    // Blocks until an event arrives or the timeout in seconds expires.
+    virtual void wait_events(const double timeout) = 0;
+    // Wakes up a thread blocked in wait_events, may be called from any thread.
+    virtual void post_empty_event() = 0;
     virtual void swap_buffers() = 0;
 
     virtual uint32_t get_width() const = 0;
@@ -42,7 +45,6 @@ public:
     virtual void maximize() = 0;
     virtual void center_window() = 0;
 
-    virtual void set_event_callback(const EventCallbackFn& callback) = 0;
     virtual void set_vsync(const bool enabled) = 0;
     virtual bool is_vsync() const = 0;
     virtual void set_resizable(const bool resizable) const = 0;
@@ -51,6 +53,9 @@ public:
     virtual void set_title(const std::string& title) = 0;
 
     virtual void* get_native_window() const = 0;
+    virtual GraphicsContext& get_context() const = 0;
+    // Events recorded while polling, to be dispatched once per frame.
+    virtual EventQueue& get_event_queue() = 0;
 
     static std::unique_ptr<Window> create(const WindowSpecs& specs);
 };
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "pine/debug/instrumentor.hpp"
+
+namespace pine
+{
+
+class GPUInstrumentor
+{
+    /*
+    Measures GPU time of profile scopes with timer queries. Queries are
+    resolved a few frames after they were issued so that reading the results
+    never stalls the pipeline. Resolved results are written to the
+    instrumentor on the GPU track.
+    */
+
+public:
+    static constexpr uint32_t InvalidQuery = ~0u;
+
+    virtual ~GPUInstrumentor() = default;
+
+    // Must be called with a current graphics context.
+    virtual uint32_t BeginQuery(const char* name) = 0;
+    virtual void EndQuery(const uint32_t query) = 0;
+
+    // Frames are measured as a whole even outside of profiling sessions.
+    // EndFrame also resolves finished queries, it must be called once per
+    // frame.
+    virtual void BeginFrame() = 0;
+    virtual void EndFrame() = 0;
+
+    // GPU time of the most recently resolved frame in milliseconds.
+    virtual float GetFrameTime() const = 0;
+
+    static GPUInstrumentor& Get();
+
+    // Releases the queries, must be called before the context is destroyed.
+    static void Shutdown();
+
+private:
+    static std::unique_ptr<GPUInstrumentor> Create();
+
+private:
+    static std::unique_ptr<GPUInstrumentor> s_Instance;
+};
+
+class GPUInstrumentationTimer
+{
+public:
+    GPUInstrumentationTimer(const char* name)
+    {
+        if (Instrumentor::Get().IsSessionActive())
+        {
+            m_Query = GPUInstrumentor::Get().BeginQuery(name);
+        }
+    }
+
+    ~GPUInstrumentationTimer()
+    {
+        if (m_Query != GPUInstrumentor::InvalidQuery)
+        {
+            GPUInstrumentor::Get().EndQuery(m_Query);
+        }
+    }
+
+private:
+    uint32_t m_Query = GPUInstrumentor::InvalidQuery;
+};
+
+} // namespace pine
+
+#if PINE_PROFILE
+#define PINE_PROFILE_GPU_SCOPE(name)                                           \
+    ::pine::GPUInstrumentationTimer PINE_PROFILE_CONCAT(gpu_timer,             \
+        __LINE__)(name);
+#else
+#define PINE_PROFILE_GPU_SCOPE(name)
+#endif
@@ -1,93 +1,70 @@
 #pragma once
 
-#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
-#include <iomanip>
+#include <memory>
 #include <mutex>
-#include <sstream>
 #include <string>
 #include <thread>
-
-#include "pine/core/log.hpp"
+#include <vector>
 
 namespace pine
 {
 
-using FloatingPointMicroseconds = std::chrono::duration<double, std::micro>;
+enum class ProfileTrack : uint8_t
+{
+    CPU,
+    GPU
+};
 
 struct ProfileResult
 {
-    std::string Name;
-    FloatingPointMicroseconds Start;
-    std::chrono::microseconds ElapsedTime;
-    std::thread::id ThreadID;
+    const char* Name; // Must point to a string with static storage duration.
+    int64_t Start; // Steady clock time in nanoseconds.
+    int64_t ElapsedTime; // Nanoseconds.
+    uint32_t ThreadID;
+    ProfileTrack Track = ProfileTrack::CPU;
 };
 
 struct InstrumentationSession
 {
     std::string Name;
+    int64_t Start;
 };
 
 class Instrumentor
 {
+    /*
+    Collects profile results in per-thread ring buffers without locking. A
+    background thread drains the buffers and writes them in the Chrome trace
+    event format. Results are dropped if a buffer is full.
+    */
+
+    struct ThreadBuffer;
+
 public:
+    static constexpr uint64_t ThreadBufferCapacity = 1 << 15;
+
     Instrumentor(const Instrumentor&) = delete;
     Instrumentor(Instrumentor&&) = delete;
 
     void BeginSession(const std::string& name,
-        const std::string& filepath = "results.json")
-    {
-        std::lock_guard lock(m_Mutex);
-        if (m_CurrentSession)
-        {
-            PINE_CORE_ERROR("Instrumentor::BeginSession('{0}') when session "
-                            "'{1}' already open.",
-                name,
-                m_CurrentSession->Name);
-            InternalEndSession();
-        }
-        m_OutputStream.open(filepath);
+        const std::string& filepath = "results.json");
+    void EndSession();
 
-        if (m_OutputStream.is_open())
-        {
-            m_CurrentSession = new InstrumentationSession({name});
-            WriteHeader();
-        }
-        else
-        {
-            PINE_CORE_ERROR("Instrumentor could not open results file '{0}'",
-                filepath);
-        }
-    }
+    void WriteProfile(const ProfileResult& result);
 
-    void EndSession()
+    bool IsSessionActive() const
     {
-        std::lock_guard lock(m_Mutex);
-        InternalEndSession();
+        return m_SessionActive.load(std::memory_order_relaxed);
     }
 
-    void WriteProfile(const ProfileResult& result)
+    uint64_t GetDroppedCount() const
     {
-        std::stringstream json;
-
-        json << std::setprecision(3) << std::fixed;
-        json << ",{";
-        json << "\"cat\":\"function\",";
-        json << "\"dur\":" << result.ElapsedTime.count() << ",";
-        json << "\"name\":\"" << result.Name << "\",";
-        json << "\"ph\":\"X\",";
-        json << "\"pid\":0,";
-        json << "\"tid\":" << result.ThreadID << ",";
-        json << "\"ts\":" << result.Start.count();
-        json << "}";
-
-        std::lock_guard lock(m_Mutex);
-        if (m_CurrentSession)
-        {
-            m_OutputStream << json.str();
-            m_OutputStream.flush();
-        }
+        return m_DroppedCount.load(std::memory_order_relaxed);
     }
 
     static Instrumentor& Get()
@@ -96,46 +73,54 @@ public:
         return instance;
     }
 
-private:
-    Instrumentor() : m_CurrentSession(nullptr) {}
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
 
+private:
+    Instrumentor() = default;
     ~Instrumentor() { EndSession(); }
 
-    void WriteHeader()
-    {
-        m_OutputStream << "{\"otherData\": {},\"traceEvents\":[{}";
-        m_OutputStream.flush();
-    }
+    ThreadBuffer& GetThreadBuffer();
 
-    void WriteFooter()
-    {
-        m_OutputStream << "]}";
-        m_OutputStream.flush();
-    }
+    void RunSerializer();
+    void DrainBuffers();
 
-    void InternalEndSession()
-    {
-        if (m_CurrentSession)
-        {
-            WriteFooter();
-            m_OutputStream.close();
-            delete m_CurrentSession;
-            m_CurrentSession = nullptr;
-        }
-    }
+    void WriteHeader();
+    void WriteFooter();
+
+    void InternalEndSession();
 
 private:
     std::mutex m_Mutex;
-    InstrumentationSession* m_CurrentSession;
+    std::unique_ptr<InstrumentationSession> m_CurrentSession;
     std::ofstream m_OutputStream;
+    std::string m_WriteBuffer;
+    std::atomic<bool> m_SessionActive = false;
+    std::atomic<uint64_t> m_DroppedCount = 0;
+
+    std::mutex m_BuffersMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_ThreadBuffers;
+
+    std::thread m_Serializer;
+    std::mutex m_SerializerMutex;
+    std::condition_variable m_SerializerCondition;
+    bool m_StopSerializer = false;
 };
 
 class InstrumentationTimer
 {
 public:
-    InstrumentationTimer(const char* name) : m_Name(name), m_Stopped(false)
+    InstrumentationTimer(const char* name)
+        : m_Name(name), m_Stopped(!Instrumentor::Get().IsSessionActive())
     {
-        m_StartTimepoint = std::chrono::steady_clock::now();
+        if (!m_Stopped)
+        {
+            m_Start = Instrumentor::Now();
+        }
     }
 
     ~InstrumentationTimer()
@@ -148,26 +133,14 @@ public:
 
     void Stop()
     {
-        auto endTimepoint = std::chrono::steady_clock::now();
-        auto highResStart =
-            FloatingPointMicroseconds{m_StartTimepoint.time_since_epoch()};
-        auto elapsedTime =
-            std::chrono::time_point_cast<std::chrono::microseconds>(
-                endTimepoint)
-                .time_since_epoch()
-            - std::chrono::time_point_cast<std::chrono::microseconds>(
-                m_StartTimepoint)
-                  .time_since_epoch();
-
-        Instrumentor::Get().WriteProfile(
-            {m_Name, highResStart, elapsedTime, std::this_thread::get_id()});
-
+        const auto end = Instrumentor::Now();
+        Instrumentor::Get().WriteProfile({m_Name, m_Start, end - m_Start, 0});
         m_Stopped = true;
     }
 
 private:
     const char* m_Name;
-    std::chrono::time_point<std::chrono::steady_clock> m_StartTimepoint;
+    int64_t m_Start = 0;
     bool m_Stopped;
 };
 
@@ -232,8 +205,10 @@ class InstrumentationUtils
 #define PINE_PROFILE_BEGIN_SESSION(name, filepath)                             \
     ::pine::Instrumentor::Get().BeginSession(name, filepath);
 #define PINE_PROFILE_END_SESSION() ::pine::Instrumentor::Get().EndSession();
+#define PINE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define PINE_PROFILE_CONCAT(a, b) PINE_PROFILE_CONCAT_IMPL(a, b)
 #define PINE_PROFILE_SCOPE(name)                                               \
-    ::pine::InstrumentationTimer timer##__LINE__(name);
+    ::pine::InstrumentationTimer PINE_PROFILE_CONCAT(timer, __LINE__)(name);
 #define PINE_PROFILE_FUNCTION() PINE_PROFILE_SCOPE(PINE_FUNC_SIG);
 #else
 #define PINE_PROFILE_BEGIN_SESSION(name, filepath)
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#if PINE_MEMORY_TRACKING
+#define PINE_TRACK_ALLOCATION(tag, bytes)                                      \
+    ::pine::MemoryTracker::allocate(tag, bytes)
+#define PINE_TRACK_DEALLOCATION(tag, bytes)                                    \
+    ::pine::MemoryTracker::deallocate(tag, bytes)
+#else
+#define PINE_TRACK_ALLOCATION(tag, bytes)
+#define PINE_TRACK_DEALLOCATION(tag, bytes)
+#endif
+
+namespace pine
+{
+
+enum class MemoryTag : uint8_t
+{
+    HEAP, // All allocations through operator new, including the tagged ones.
+    TEXTURE, // GPU.
+    BUFFER, // GPU, vertex and index buffers.
+    FRAMEBUFFER, // GPU.
+    QUEUE, // Storage of locked queues.
+    IMAGE // Pixels of images.
+};
+
+static constexpr uint32_t memory_tag_count = 6;
+
+struct MemoryStatistics
+{
+    uint64_t current_bytes = 0;
+    uint64_t peak_bytes = 0;
+    uint64_t allocation_count = 0;
+    uint64_t deallocation_count = 0;
+    uint64_t allocated_bytes = 0;
+    // Over the last update interval.
+    float allocations_per_second = 0.0f;
+    float allocated_bytes_per_second = 0.0f;
+};
+
+class MemoryTracker
+{
+    /*
+    Opt-in accounting of memory use by tag, enabled with the CMake option
+    PINE_ENABLE_MEMORY_TRACKING. Heap allocations are counted by replacing
+    the global operator new and delete, while GPU resources, images and
+    queues account for their memory explicitly. May be used from any thread.
+    */
+
+public:
+    static void allocate(const MemoryTag tag, const uint64_t bytes);
+    static void deallocate(const MemoryTag tag, const uint64_t bytes);
+
+    static MemoryStatistics get_statistics(const MemoryTag tag);
+
+    // Updates the allocation rates, called by the application once per frame.
+    static void update();
+
+    static const char* get_name(const MemoryTag tag);
+
+    static constexpr bool is_enabled()
+    {
+#if PINE_MEMORY_TRACKING
+        return true;
+#else
+        return false;
+#endif
+    }
+};
+
+template <typename T, MemoryTag Tag>
+class TrackingAllocator
+{
+    /*
+    Standard allocator that accounts for its memory under a tag.
+    */
+
+public:
+    using value_type = T;
+
+    TrackingAllocator() = default;
+
+    template <typename U>
+    TrackingAllocator([[maybe_unused]] const TrackingAllocator<U, Tag>& other)
+    {
+    }
+
+    T* allocate(const size_t count)
+    {
+        PINE_TRACK_ALLOCATION(Tag, count * sizeof(T));
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, const size_t count)
+    {
+        PINE_TRACK_DEALLOCATION(Tag, count * sizeof(T));
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TrackingAllocator<U, Tag>;
+    };
+
+    template <typename U>
+    bool operator==([[maybe_unused]] const TrackingAllocator<U, Tag>& other)
+        const
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=([[maybe_unused]] const TrackingAllocator<U, Tag>& other)
+        const
+    {
+        return false;
+    }
+};
+
+} // namespace pine
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace pine
+{
+
+enum class FrameMetric : uint8_t
+{
+    CPU_TIME, // Milliseconds.
+    GPU_TIME, // Milliseconds, lags a few frames behind.
+    TIMESTEP, // Milliseconds.
+    DRAW_CALLS,
+    UPLOADED_BYTES,
+    NETWORK_BYTES,
+    FRAME_ALLOCATIONS, // Frame allocator of the main thread.
+    FRAME_HEAP_ALLOCATIONS, // Frame allocator growth, all threads.
+    STATE_CHANGES, // Issued by the graphics state cache.
+    REDUNDANT_STATE_CHANGES // Skipped by the graphics state cache.
+};
+
+static constexpr uint32_t frame_metric_count = 10;
+
+class MetricHistory
+{
+    /*
+    Fixed-size ring buffer with the most recent values of a metric.
+    */
+
+public:
+    static constexpr uint32_t capacity = 512;
+
+    void push(const float value)
+    {
+        m_values[m_offset] = value;
+        m_offset = (m_offset + 1) % capacity;
+        m_count = std::min(m_count + 1, capacity);
+    }
+
+    // Index 0 is the oldest value.
+    float get(const uint32_t index) const
+    {
+        return m_values[(m_offset + capacity - m_count + index) % capacity];
+    }
+
+    float get_latest() const { return m_count ? get(m_count - 1) : 0.0f; }
+
+    uint32_t get_count() const { return m_count; }
+
+    // Raw ring buffer access for plotting, start at get_offset() to plot in
+    // chronological order.
+    const float* get_data() const { return m_values.data(); }
+    uint32_t get_offset() const { return m_count < capacity ? 0 : m_offset; }
+
+private:
+    std::array<float, capacity> m_values = {};
+    uint32_t m_offset = 0;
+    uint32_t m_count = 0;
+};
+
+struct MetricSummary
+{
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    float max = 0.0f;
+};
+
+MetricSummary summarize(const MetricHistory& history);
+
+class Metrics
+{
+    /*
+    Per-frame performance metrics. Counters may be incremented from any
+    thread, the application folds them into the histories once per frame.
+    */
+
+public:
+    static void count(const FrameMetric metric, const uint64_t value)
+    {
+        s_counters[static_cast<size_t>(metric)].fetch_add(value,
+            std::memory_order_relaxed);
+    }
+
+    static void end_frame(const float cpu_time, const float gpu_time,
+        const float timestep);
+
+    static const MetricHistory& get_history(const FrameMetric metric)
+    {
+        return s_histories[static_cast<size_t>(metric)];
+    }
+
+    static const char* get_name(const FrameMetric metric);
+
+private:
+    static std::array<std::atomic<uint64_t>, frame_metric_count> s_counters;
+    static std::array<MetricHistory, frame_metric_count> s_histories;
+};
+
+} // namespace pine
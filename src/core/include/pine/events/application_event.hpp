@@ -12,14 +12,14 @@ class WindowResizeEvent : public Event
 {
 public:
     WindowResizeEvent(unsigned int width, unsigned int height)
-        : m_width(width), m_height(height)
+        : Event(get_static_type()), m_width(width), m_height(height)
     {
     }
 
     inline uint32_t get_width() const { return m_width; }
     inline uint32_t get_height() const { return m_height; }
 
-    std::string to_string() const override
+    std::string to_string() const
     {
         std::stringstream ss;
         ss << "[WindowResizeEvent] " << m_width << ", " << m_height;
@@ -27,7 +27,6 @@ public:
     }
 
     EVENT_CLASS_TYPE(WindowResize)
-    EVENT_CLASS_CATEGORY(EventCategoryApplication)
 
 private:
     uint32_t m_width;
@@ -37,12 +36,14 @@ private:
 class WindowIconifyEvent : public Event
 {
 public:
-    WindowIconifyEvent(bool minimized) : m_minimized(minimized) {}
+    WindowIconifyEvent(bool minimized)
+        : Event(get_static_type()), m_minimized(minimized)
+    {
+    }
 
     bool is_minimized() const { return m_minimized; }
 
     EVENT_CLASS_TYPE(WindowIconify)
-    EVENT_CLASS_CATEGORY(EventCategoryApplication)
 private:
     bool m_minimized;
 };
@@ -50,28 +51,25 @@ private:
 class WindowCloseEvent : public Event
 {
 public:
-    WindowCloseEvent() = default;
+    WindowCloseEvent() : Event(get_static_type()) {}
 
     EVENT_CLASS_TYPE(WindowClose)
-    EVENT_CLASS_CATEGORY(EventCategoryApplication)
 };
 
 class AppUpdateEvent : public Event
 {
 public:
-    AppUpdateEvent() = default;
+    AppUpdateEvent() : Event(get_static_type()) {}
 
     EVENT_CLASS_TYPE(AppUpdate)
-    EVENT_CLASS_CATEGORY(EventCategoryApplication)
 };
 
 class AppRenderEvent : public Event
 {
 public:
-    AppRenderEvent() = default;
+    AppRenderEvent() : Event(get_static_type()) {}
 
     EVENT_CLASS_TYPE(AppRender)
-    EVENT_CLASS_CATEGORY(EventCategoryApplication)
 };
 
 } // namespace pine
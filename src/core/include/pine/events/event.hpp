@@ -27,6 +27,9 @@ enum class EventType
     MouseScrolled
 };
 
+constexpr size_t event_type_count =
+    static_cast<size_t>(EventType::MouseScrolled) + 1;
+
 enum EventCategory
 {
     None = 0,
@@ -37,43 +40,108 @@ enum EventCategory
     EventCategoryMouseButton = BIT(4)
 };
 
+// Events are identified by a type ID stored in the event rather than by
+// virtual functions, so that they are cheap to copy, queue and dispatch.
 #define EVENT_CLASS_TYPE(type)                                                 \
-    static EventType get_static_type()                                         \
+    static constexpr EventType get_static_type()                               \
     {                                                                          \
         return EventType::type;                                                \
-    }                                                                          \
-    virtual EventType get_event_type() const override                          \
-    {                                                                          \
-        return get_static_type();                                              \
-    }                                                                          \
-    virtual const char* get_name() const override                              \
-    {                                                                          \
-        return #type;                                                          \
     }
 
-#define EVENT_CLASS_CATEGORY(category)                                         \
-    virtual int get_category_flags() const override                            \
-    {                                                                          \
-        return category;                                                       \
+constexpr const char* get_event_name(const EventType type)
+{
+    switch (type)
+    {
+    case EventType::None:
+        return "None";
+    case EventType::WindowClose:
+        return "WindowClose";
+    case EventType::WindowResize:
+        return "WindowResize";
+    case EventType::WindowIconify:
+        return "WindowIconify";
+    case EventType::WindowFocus:
+        return "WindowFocus";
+    case EventType::WindowLostFocus:
+        return "WindowLostFocus";
+    case EventType::WindowMoved:
+        return "WindowMoved";
+    case EventType::AppTick:
+        return "AppTick";
+    case EventType::AppUpdate:
+        return "AppUpdate";
+    case EventType::AppRender:
+        return "AppRender";
+    case EventType::KeyPressed:
+        return "KeyPressed";
+    case EventType::KeyReleased:
+        return "KeyReleased";
+    case EventType::KeyTyped:
+        return "KeyTyped";
+    case EventType::MouseButtonPressed:
+        return "MouseButtonPressed";
+    case EventType::MouseButtonReleased:
+        return "MouseButtonReleased";
+    case EventType::MouseMoved:
+        return "MouseMoved";
+    case EventType::MouseScrolled:
+        return "MouseScrolled";
+    }
+    return "Unknown";
+}
+
+constexpr int get_event_category_flags(const EventType type)
+{
+    switch (type)
+    {
+    case EventType::None:
+        return EventCategory::None;
+    case EventType::WindowClose:
+    case EventType::WindowResize:
+    case EventType::WindowIconify:
+    case EventType::WindowFocus:
+    case EventType::WindowLostFocus:
+    case EventType::WindowMoved:
+    case EventType::AppTick:
+    case EventType::AppUpdate:
+    case EventType::AppRender:
+        return EventCategoryApplication;
+    case EventType::KeyPressed:
+    case EventType::KeyReleased:
+    case EventType::KeyTyped:
+        return EventCategoryKeyboard | EventCategoryInput;
+    case EventType::MouseButtonPressed:
+    case EventType::MouseButtonReleased:
+        return EventCategoryMouse | EventCategoryMouseButton
+            | EventCategoryInput;
+    case EventType::MouseMoved:
+    case EventType::MouseScrolled:
+        return EventCategoryMouse | EventCategoryInput;
     }
+    return EventCategory::None;
+}
 
 class Event
 {
 public:
-    virtual ~Event() = default;
-
-    virtual EventType get_event_type() const = 0;
-    virtual const char* get_name() const = 0;
-    virtual int get_category_flags() const = 0;
-    virtual std::string to_string() const { return get_name(); }
+    EventType get_event_type() const { return m_type; }
+    const char* get_name() const { return get_event_name(m_type); }
+    int get_category_flags() const { return get_event_category_flags(m_type); }
+    std::string to_string() const { return get_name(); }
 
     bool is_in_category(const EventCategory& category) const
     {
         return get_category_flags() & category;
     }
 
+protected:
+    Event(const EventType type) : m_type(type) {}
+
 public:
     mutable bool handled = false;
+
+private:
+    EventType m_type;
 };
 
 template <typename T, typename Callable>
@@ -81,7 +149,7 @@ bool dispatch_event(const Event& event, const Callable& callable)
 {
     if (event.get_event_type() == T::get_static_type())
     {
-        event.handled = callable(static_cast<T&>(event));
+        event.handled = callable(static_cast<const T&>(event));
         return true;
     }
     return false;
@@ -107,9 +175,54 @@ private:
     Event& m_event;
 };
 
-inline std::ostream& operator<<(std::ostream& os, Event& event)
+class EventHandlerTable
 {
-    return os << event.to_string();
-}
+    /*
+    Event handlers indexed by event type, so that an event is passed to its
+    handler with a single lookup instead of a chain of type comparisons.
+    */
+
+public:
+    using HandlerFn = std::function<bool(Event&)>;
+
+    // Sets the handler for an event type. The handler marks the event as
+    // handled if it returns true.
+    template <typename T, typename Func>
+    void set(Func&& func)
+    {
+        m_handlers[get_index(T::get_static_type())] =
+            [func = std::forward<Func>(func)](Event& event) -> bool
+        {
+            return func(static_cast<T&>(event));
+        };
+    }
+
+    template <typename T>
+    void reset()
+    {
+        m_handlers[get_index(T::get_static_type())] = nullptr;
+    }
+
+    // Returns true if there is a handler for the type of the event.
+    bool dispatch(Event& event) const
+    {
+        const auto& handler = m_handlers[get_index(event.get_event_type())];
+        if (handler)
+        {
+            event.handled = handler(event);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    static constexpr size_t get_index(const EventType type)
+    {
+        return static_cast<size_t>(type);
+    }
+
+private:
+    std::array<HandlerFn, event_type_count> m_handlers;
+};
 
 } // namespace pine
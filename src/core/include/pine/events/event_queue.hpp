@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "pine/core/chunked_arena.hpp"
+#include "pine/events/event.hpp"
+
+namespace pine
+{
+
+class EventQueue
+{
+    /*
+    Records events as they arrive, e.g. from the window callbacks, so that
+    they can be dispatched in one batch per frame. Events are stored in an
+    arena that is kept between frames, so recording stops allocating once the
+    queue has grown to fit a frame. Consecutive mouse move and window resize
+    events are coalesced into the latest one.
+    */
+
+    struct Record
+    {
+        EventType type;
+        Event* event;
+    };
+
+public:
+    EventQueue() = default;
+    ~EventQueue();
+
+    EventQueue(const EventQueue&) = delete;
+    EventQueue(EventQueue&&) = delete;
+
+    EventQueue& operator=(const EventQueue&) = delete;
+    EventQueue& operator=(EventQueue&&) = delete;
+
+    template <typename T, typename... Args>
+    void push(Args&&... args)
+    {
+        static_assert(std::is_base_of_v<Event, T>, "T must be an event.");
+        static_assert(std::is_trivially_destructible_v<T>,
+            "Events must be trivially destructible.");
+
+        constexpr auto type = T::get_static_type();
+        if (is_coalesced(type) && !m_records.empty()
+            && m_records.back().type == type)
+        {
+            *static_cast<T*>(m_records.back().event) =
+                T(std::forward<Args>(args)...);
+            return;
+        }
+
+        auto* storage = m_arena.allocate(sizeof(T), alignof(T));
+        m_records.push_back(
+            {type, new (storage) T(std::forward<Args>(args)...)});
+    }
+
+    // Sets the handler for an event type, which runs before the dispatch
+    // callback and marks the event as handled if it returns true.
+    template <typename T, typename Func>
+    void set_handler(Func&& func)
+    {
+        m_handlers.set<T>(std::forward<Func>(func));
+    }
+
+    // Runs the handler for the type of each event, if any, then the callback
+    // in the order the events were recorded, and clears the queue. Events
+    // recorded during the dispatch are dispatched as well.
+    template <typename Func>
+    void dispatch(const Func& callback)
+    {
+        for (size_t index = 0; index < m_records.size(); index++)
+        {
+            auto& event = *m_records[index].event;
+            m_handlers.dispatch(event);
+            callback(event);
+        }
+        clear();
+    }
+
+    // Destroys the events without dispatching them.
+    void clear();
+
+    size_t size() const { return m_records.size(); }
+    bool empty() const { return m_records.empty(); }
+
+private:
+    static constexpr bool is_coalesced(const EventType type)
+    {
+        return type == EventType::MouseMoved || type == EventType::WindowResize;
+    }
+
+private:
+    static constexpr size_t s_chunk_size = 16 * 1024;
+
+    std::vector<Record> m_records;
+    ChunkedArena m_arena{s_chunk_size};
+
+    EventHandlerTable m_handlers;
+};
+
+} // namespace pine
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "pine/events/application_event.hpp"
+#include "pine/events/event.hpp"
+#include "pine/events/key_event.hpp"
+#include "pine/events/mouse_event.hpp"
+
+namespace pine
+{
+
+// Holds any event by value, e.g. to store events of mixed types.
+using EventVariant = std::variant<WindowResizeEvent,
+    WindowIconifyEvent,
+    WindowCloseEvent,
+    AppUpdateEvent,
+    AppRenderEvent,
+    KeyPressedEvent,
+    KeyReleasedEvent,
+    KeyTypedEvent,
+    MouseButtonPressedEvent,
+    MouseButtonReleasedEvent,
+    MouseMovedEvent,
+    MouseScrolledEvent>;
+
+namespace detail
+{
+
+template <typename Func, typename... Types>
+bool visit_event(Event& event, Func& func, std::variant<Types...>*)
+{
+    // Expands to a comparison of the type ID per event type, which compilers
+    // turn into a jump table.
+    return ((event.get_event_type() == Types::get_static_type()
+                && (func(static_cast<Types&>(event)), true))
+        || ...);
+}
+
+} // namespace detail
+
+// Calls func with the event cast to its concrete type. Returns false if the
+// event type has no class.
+template <typename Func>
+bool visit_event(Event& event, Func&& func)
+{
+    return detail::visit_event(event,
+        func,
+        static_cast<EventVariant*>(nullptr));
+}
+
+template <typename Func>
+bool visit_event(const Event& event, Func&& func)
+{
+    return visit_event(const_cast<Event&>(event),
+        [&func](auto& typed_event)
+        {
+            func(static_cast<const std::decay_t<decltype(typed_event)>&>(
+                typed_event));
+        });
+}
+
+inline std::string to_string(const Event& event)
+{
+    std::string text = event.get_name();
+    visit_event(event,
+        [&text](const auto& typed_event) { text = typed_event.to_string(); });
+    return text;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const Event& event)
+{
+    return os << to_string(event);
+}
+
+// Helper for visiting with a set of lambdas, one per event type.
+template <typename... Funcs>
+struct EventOverloads : Funcs...
+{
+    using Funcs::operator()...;
+};
+
+template <typename... Funcs>
+EventOverloads(Funcs...) -> EventOverloads<Funcs...>;
+
+} // namespace pine
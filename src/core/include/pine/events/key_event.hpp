@@ -14,10 +14,11 @@ class KeyEvent : public Event
 public:
     KeyCode GetKeyCode() const { return m_key_code; }
 
-    EVENT_CLASS_CATEGORY(EventCategoryKeyboard | EventCategoryInput)
-
 protected:
-    KeyEvent(const KeyCode key_code) : m_key_code(key_code) {}
+    KeyEvent(const EventType type, const KeyCode key_code)
+        : Event(type), m_key_code(key_code)
+    {
+    }
 
     KeyCode m_key_code;
 };
@@ -26,13 +27,13 @@ class KeyPressedEvent : public KeyEvent
 {
 public:
     KeyPressedEvent(const KeyCode key_code, const int repeat_count)
-        : KeyEvent(key_code), m_repeat_count(repeat_count)
+        : KeyEvent(get_static_type(), key_code), m_repeat_count(repeat_count)
     {
     }
 
     int GetRepeatCount() const { return m_repeat_count; }
 
-    std::string to_string() const override
+    std::string to_string() const
     {
         std::stringstream ss;
         ss << "[KeyPressedEvent] " << m_key_code << " (" << m_repeat_count
@@ -49,9 +50,12 @@ private:
 class KeyReleasedEvent : public KeyEvent
 {
 public:
-    KeyReleasedEvent(const KeyCode key_code) : KeyEvent(key_code) {}
+    KeyReleasedEvent(const KeyCode key_code)
+        : KeyEvent(get_static_type(), key_code)
+    {
+    }
 
-    std::string to_string() const override
+    std::string to_string() const
     {
         std::stringstream ss;
         ss << "[KeyReleasedEvent] " << m_key_code;
@@ -64,9 +68,12 @@ public:
 class KeyTypedEvent : public KeyEvent
 {
 public:
-    KeyTypedEvent(const KeyCode key_code) : KeyEvent(key_code) {}
+    KeyTypedEvent(const KeyCode key_code)
+        : KeyEvent(get_static_type(), key_code)
+    {
+    }
 
-    std::string to_string() const override
+    std::string to_string() const
     {
         std::stringstream ss;
         ss << "[KeyTypedEvent] " << m_key_code;
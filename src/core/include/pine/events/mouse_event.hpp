@@ -11,14 +11,15 @@ namespace pine
 class MouseMovedEvent : public Event
 {
 public:
-    MouseMovedEvent(const float x, const float y) : m_mouse_x(x), m_mouse_y(y)
+    MouseMovedEvent(const float x, const float y)
+        : Event(get_static_type()), m_mouse_x(x), m_mouse_y(y)
     {
     }
 
     float get_x() const { return m_mouse_x; }
     float get_y() const { return m_mouse_y; }
 
-    std::string to_string() const override
+    std::string to_string() const
     {
         std::stringstream ss;
         ss << "[MouseMovedEvent] " << get_x() << ", " << get_y();
@@ -26,7 +27,6 @@ public:
     }
 
     EVENT_CLASS_TYPE(MouseMoved)
-    EVENT_CLASS_CATEGORY(EventCategoryMouse | EventCategoryInput)
 
 private:
     float m_mouse_x, m_mouse_y;
@@ -36,14 +36,14 @@ class MouseScrolledEvent : public Event
 {
 public:
     MouseScrolledEvent(const float offsetX, const float offsetY)
-        : m_offset_x(offsetX), m_offset_y(offsetY)
+        : Event(get_static_type()), m_offset_x(offsetX), m_offset_y(offsetY)
     {
     }
 
     float get_offset_x() const { return m_offset_x; }
     float get_offset_y() const { return m_offset_y; }
 
-    std::string to_string() const override
+    std::string to_string() const
     {
         std::stringstream ss;
         ss << "[MouseScrolledEvent] " << get_offset_x() << ", "
@@ -52,7 +52,6 @@ public:
     }
 
     EVENT_CLASS_TYPE(MouseScrolled)
-    EVENT_CLASS_CATEGORY(EventCategoryMouse | EventCategoryInput)
 
 private:
     float m_offset_x, m_offset_y;
@@ -63,10 +62,11 @@ class MouseButtonEvent : public Event
 public:
     inline MouseCode GetMouseButton() const { return m_button; }
 
-    EVENT_CLASS_CATEGORY(EventCategoryMouse | EventCategoryInput)
-
 protected:
-    MouseButtonEvent(const MouseCode button) : m_button(button) {}
+    MouseButtonEvent(const EventType type, const MouseCode button)
+        : Event(type), m_button(button)
+    {
+    }
 
     MouseCode m_button;
 };
@@ -74,11 +74,12 @@ protected:
 class MouseButtonPressedEvent : public MouseButtonEvent
 {
 public:
-    MouseButtonPressedEvent(const MouseCode button) : MouseButtonEvent(button)
+    MouseButtonPressedEvent(const MouseCode button)
+        : MouseButtonEvent(get_static_type(), button)
     {
     }
 
-    std::string to_string() const override
+    std::string to_string() const
     {
         std::stringstream ss;
         ss << "[MouseButtonPressedEvent] " << m_button;
@@ -91,11 +92,12 @@ public:
 class MouseButtonReleasedEvent : public MouseButtonEvent
 {
 public:
-    MouseButtonReleasedEvent(const MouseCode button) : MouseButtonEvent(button)
+    MouseButtonReleasedEvent(const MouseCode button)
+        : MouseButtonEvent(get_static_type(), button)
     {
     }
 
-    std::string to_string() const override
+    std::string to_string() const
     {
         std::stringstream ss;
         ss << "[MouseButtonReleasedEvent] " << m_button;
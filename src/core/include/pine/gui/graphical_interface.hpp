@@ -10,7 +10,7 @@ namespace pine
 class GraphicalInterface
 {
 public:
-    GraphicalInterface(Window* window);
+    GraphicalInterface(Window* window, const bool enable_viewports = true);
     ~GraphicalInterface();
 
     void begin_frame();
@@ -21,7 +21,8 @@ public:
     void block_events(const bool block) { m_block_events = block; }
 
     // Factory method
-    static std::unique_ptr<GraphicalInterface> create(Window* window);
+    static std::unique_ptr<GraphicalInterface> create(Window* window,
+        const bool enable_viewports = true);
 
 private:
     Window* m_window;
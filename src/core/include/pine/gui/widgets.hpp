@@ -1,5 +1,8 @@
 #pragma once
 
+#include <implot.h>
+
+#include "pine/debug/metrics.hpp"
 #include "pine/gui/common.hpp"
 #include "pine/renderer/framebuffer.hpp"
 #include "pine/utils/math.hpp"
@@ -128,17 +131,76 @@ inline auto render_viewport(const char* name, const Framebuffer& framebuffer)
 
     const auto state = get_panel_state();
     const auto texture_id = framebuffer.get_color_attachment_renderer_id();
+    const auto& specs = framebuffer.get_specification();
+
+    // Only the region of the attachment that is rendered to is shown.
+    const auto u = static_cast<float>(specs.width)
+        / static_cast<float>(framebuffer.get_capacity_width());
+    const auto v = static_cast<float>(specs.height)
+        / static_cast<float>(framebuffer.get_capacity_height());
 
     ImGui::Image(reinterpret_cast<void*>(texture_id),
         ImVec2{state.size.x, state.size.y},
-        ImVec2{0, 1},
-        ImVec2{1, 0});
+        ImVec2{0, v},
+        ImVec2{u, 0});
 
     ImGui::End();
 
     return state;
 }
 
+inline void metric_plot(const char* name, const MetricHistory& history,
+    const float height = 80.0f)
+{
+    const auto summary = summarize(history);
+    ImGui::Text("%s", name);
+    ImGui::Text("p50 %.2f  p95 %.2f  p99 %.2f  max %.2f",
+        static_cast<double>(summary.p50),
+        static_cast<double>(summary.p95),
+        static_cast<double>(summary.p99),
+        static_cast<double>(summary.max));
+
+    if (ImPlot::BeginPlot(name, ImVec2(-1.0f, height), ImPlotFlags_CanvasOnly))
+    {
+        ImPlot::SetupAxes(nullptr,
+            nullptr,
+            ImPlotAxisFlags_NoDecorations,
+            ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxisLimits(ImAxis_X1,
+            0.0,
+            MetricHistory::capacity,
+            ImPlotCond_Always);
+
+        ImPlot::PlotLine(name,
+            history.get_data(),
+            static_cast<int>(history.get_count()),
+            1.0,
+            0.0,
+            0,
+            static_cast<int>(history.get_offset()));
+
+        const auto p99 = static_cast<double>(summary.p99);
+        ImPlot::PlotInfLines("p99", &p99, 1, ImPlotInfLinesFlags_Horizontal);
+        ImPlot::EndPlot();
+    }
+}
+
+inline void metric_histogram(const char* name, const MetricHistory& history,
+    const float height = 120.0f)
+{
+    if (ImPlot::BeginPlot(name, ImVec2(-1.0f, height), ImPlotFlags_NoLegend))
+    {
+        ImPlot::SetupAxes(nullptr,
+            nullptr,
+            ImPlotAxisFlags_AutoFit,
+            ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotHistogram(name,
+            history.get_data(),
+            static_cast<int>(history.get_count()));
+        ImPlot::EndPlot();
+    }
+}
+
 // TODO: Improve templating - Allow container to be vector. (C++20s std::span)
 template <typename T, size_t N>
 auto dropdown(const char* name, T* t,
@@ -2,8 +2,11 @@
 
 // Core
 #include "pine/core/application.hpp"
+#include "pine/core/chunked_arena.hpp"
 #include "pine/core/common.hpp"
+#include "pine/core/frame_allocator.hpp"
 #include "pine/core/input.hpp"
+#include "pine/core/job_system.hpp"
 #include "pine/core/key_codes.hpp"
 #include "pine/core/layer.hpp"
 #include "pine/core/log.hpp"
@@ -12,7 +15,10 @@
 #include "pine/core/window.hpp"
 
 // Debug stuff
+#include "pine/debug/gpu_instrumentor.hpp"
 #include "pine/debug/instrumentor.hpp"
+#include "pine/debug/memory_tracker.hpp"
+#include "pine/debug/metrics.hpp"
 
 // Graphical user interface
 #include "pine/gui/common.hpp"
@@ -26,16 +32,28 @@
 #include "pine/network/types.hpp"
 
 // Renderer
+#include "pine/renderer/batch_renderer.hpp"
 #include "pine/renderer/buffer.hpp"
 #include "pine/renderer/camera.hpp"
+#include "pine/renderer/circle_renderer.hpp"
 #include "pine/renderer/common.hpp"
+#include "pine/renderer/font.hpp"
 #include "pine/renderer/framebuffer.hpp"
 #include "pine/renderer/image.hpp"
+#include "pine/renderer/image_writer.hpp"
+#include "pine/renderer/line_renderer.hpp"
+#include "pine/renderer/mesh_renderer.hpp"
+#include "pine/renderer/point_cloud.hpp"
+#include "pine/renderer/point_cloud_renderer.hpp"
 #include "pine/renderer/quad_renderer.hpp"
 #include "pine/renderer/render_command.hpp"
 #include "pine/renderer/renderer.hpp"
 #include "pine/renderer/shader.hpp"
+#include "pine/renderer/text_renderer.hpp"
 #include "pine/renderer/texture.hpp"
+#include "pine/renderer/texture_cache.hpp"
+#include "pine/renderer/tilemap.hpp"
+#include "pine/renderer/tilemap_renderer.hpp"
 
 // Utils
 #include "pine/utils/filesystem.hpp"
@@ -21,6 +21,8 @@ public:
 
     virtual void init() override;
     virtual void poll_events() override;
+    virtual void wait_events(const double timeout) override;
+    virtual void post_empty_event() override;
     virtual void swap_buffers() override;
 
     inline uint32_t get_width() const override { return m_data.width; }
@@ -31,7 +33,6 @@ public:
     virtual void maximize() override;
     virtual void center_window() override;
 
-    virtual void set_event_callback(const EventCallbackFn& callback) override;
     virtual void set_vsync(const bool enabled) override;
     virtual bool is_vsync() const override;
     virtual void set_resizable(const bool resizable) const override;
@@ -40,6 +41,14 @@ public:
     virtual void set_title(const std::string& title) override;
 
     virtual void* get_native_window() const override { return m_window; }
+    virtual GraphicsContext& get_context() const override
+    {
+        return *m_context;
+    }
+    virtual EventQueue& get_event_queue() override
+    {
+        return m_data.event_queue;
+    }
 
 private:
     virtual void shutdown();
@@ -52,7 +61,7 @@ private:
         uint32_t height;
         bool vsync;
 
-        EventCallbackFn event_callback;
+        EventQueue event_queue;
     };
 
 private:
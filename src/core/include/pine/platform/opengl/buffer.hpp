@@ -16,7 +16,8 @@ public:
     virtual void bind() const override;
     virtual void unbind() const override;
 
-    virtual void set_data(const void* data, const uint32_t size) override;
+    virtual void set_data(const void* data, const uint32_t size,
+        const uint32_t offset = 0) override;
 
     virtual const VertexBufferLayout& get_layout() const override
     {
@@ -30,11 +31,13 @@ public:
 private:
     RendererID m_renderer_id;
     VertexBufferLayout m_layout;
+    uint32_t m_size;
 };
 
 class OpenGLIndexBuffer : public IndexBuffer
 {
 public:
+    OpenGLIndexBuffer(const uint32_t count);
     OpenGLIndexBuffer(const uint32_t* indices, const uint32_t count);
     virtual ~OpenGLIndexBuffer();
 
@@ -43,11 +46,70 @@ public:
 
     virtual uint32_t get_count() const override { return m_count; }
 
+    virtual void set_data(const uint32_t* indices, const uint32_t count,
+        const uint32_t offset = 0) override;
+
 private:
     RendererID m_renderer_id;
     uint32_t m_count;
 };
 
+class OpenGLUniformBuffer : public UniformBuffer
+{
+public:
+    OpenGLUniformBuffer(const uint32_t size, const uint32_t binding);
+    virtual ~OpenGLUniformBuffer();
+
+    virtual void set_data(const void* data, const uint32_t size,
+        const uint32_t offset = 0) override;
+
+    virtual uint32_t get_binding() const override { return m_binding; }
+
+private:
+    RendererID m_renderer_id;
+    uint32_t m_size;
+    uint32_t m_binding;
+};
+
+class OpenGLStorageBuffer : public StorageBuffer
+{
+public:
+    OpenGLStorageBuffer(const uint32_t size, const uint32_t binding);
+    virtual ~OpenGLStorageBuffer();
+
+    virtual void bind() const override;
+
+    virtual void set_data(const void* data, const uint32_t size,
+        const uint32_t offset = 0) override;
+
+    virtual uint32_t get_size() const override { return m_size; }
+    virtual uint32_t get_binding() const override { return m_binding; }
+
+private:
+    RendererID m_renderer_id;
+    uint32_t m_size;
+    uint32_t m_binding;
+};
+
+class OpenGLIndirectBuffer : public IndirectBuffer
+{
+public:
+    OpenGLIndirectBuffer(const uint32_t size);
+    virtual ~OpenGLIndirectBuffer();
+
+    virtual void bind() const override;
+    virtual void bind_base(const uint32_t binding) const override;
+
+    virtual void set_data(const void* data, const uint32_t size,
+        const uint32_t offset = 0) override;
+
+    virtual uint32_t get_size() const override { return m_size; }
+
+private:
+    RendererID m_renderer_id;
+    uint32_t m_size;
+};
+
 class OpenGLVertexArray : public VertexArray
 {
 public:
@@ -15,6 +15,9 @@ public:
     virtual void init() override;
     virtual void swap_buffers() override;
 
+    virtual void make_current() override;
+    virtual void release() override;
+
 private:
     GLFWwindow* m_window_handle;
 };
@@ -1,12 +1,89 @@
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "pine/renderer/framebuffer.hpp"
 
 namespace pine
 {
 
+struct OpenGLAttachmentKey
+{
+    uint32_t format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t samples;
+    bool renderbuffer;
+
+    bool operator==(const OpenGLAttachmentKey& other) const
+    {
+        return format == other.format && width == other.width
+            && height == other.height && samples == other.samples
+            && renderbuffer == other.renderbuffer;
+    }
+};
+
+class OpenGLAttachmentPool
+{
+    /*
+    Keeps released framebuffer attachments for reuse, keyed by internal
+    format, size, sample count and whether they are render buffers. Since
+    framebuffers allocate in size classes, attachments of a resized or
+    destroyed framebuffer are likely to fit the next one. Pooled attachments
+    live as long as the context.
+    */
+
+    struct Attachment
+    {
+        OpenGLAttachmentKey key;
+        RendererID renderer_id;
+    };
+
+public:
+    static OpenGLAttachmentPool& get();
+
+    // Returns a pooled attachment, or creates one if there is none.
+    RendererID acquire(const OpenGLAttachmentKey& key);
+    void release(const OpenGLAttachmentKey& key, const RendererID renderer_id);
+
+    uint32_t get_count() const
+    {
+        return static_cast<uint32_t>(m_attachments.size());
+    }
+
+private:
+    OpenGLAttachmentPool() = default;
+
+    static void destroy(const Attachment& attachment);
+
+private:
+    static constexpr uint32_t s_max_attachment_count = 8;
+
+    std::vector<Attachment> m_attachments;
+};
+
 class OpenGLFramebuffer : public Framebuffer
 {
+    /*
+    The attachments are allocated with a capacity that is rounded up to a
+    size class, and rendering is limited to the specified size. Resizing
+    within the capacity only changes the viewport.
+
+    Multisampled framebuffers render to multisampled render buffers, which
+    are resolved into textures when the framebuffer is unbound.
+    */
+
+    struct Attachment
+    {
+        FramebufferAttachmentSpecs specs;
+        OpenGLAttachmentKey key;
+        RendererID renderer_id = 0;
+        // Single sampled texture that a multisampled attachment resolves to.
+        OpenGLAttachmentKey resolve_key;
+        RendererID resolve_id = 0;
+    };
+
 public:
     OpenGLFramebuffer(const FramebufferSpecs& specs);
     virtual ~OpenGLFramebuffer();
@@ -18,20 +95,50 @@ public:
 
     virtual void resize(const uint32_t width, const uint32_t height) override;
 
-    virtual RendererID get_color_attachment_renderer_id() const override
-    {
-        return m_color_attachment;
-    }
+    virtual RendererID get_color_attachment_renderer_id(
+        const uint32_t index = 0) const override;
+
+    virtual Image read_color_attachment() const override;
+
+    virtual uint32_t read_pixel(const uint32_t index, const uint32_t x,
+        const uint32_t y) const override;
+
+    virtual void clear_attachment(const uint32_t index,
+        const uint32_t value) override;
 
     virtual const FramebufferSpecs& get_specification() const override
     {
         return m_specification;
     }
 
+    virtual uint32_t get_capacity_width() const override
+    {
+        return m_capacity_width;
+    }
+
+    virtual uint32_t get_capacity_height() const override
+    {
+        return m_capacity_height;
+    }
+
+private:
+    void resolve();
+    void release_attachments();
+
+    // The texture that is sampled, i.e. the resolved one when multisampled.
+    RendererID get_sampled_id(const Attachment& attachment) const
+    {
+        return attachment.resolve_id ? attachment.resolve_id
+                                     : attachment.renderer_id;
+    }
+
 private:
     RendererID m_renderer_id = 0;
-    RendererID m_color_attachment = 0;
-    RendererID m_depth_attachment = 0;
+    RendererID m_resolve_id = 0;
+    std::vector<Attachment> m_color_attachments;
+    std::optional<Attachment> m_depth_attachment;
+    uint32_t m_capacity_width = 0;
+    uint32_t m_capacity_height = 0;
     FramebufferSpecs m_specification;
 };
 
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "pine/debug/gpu_instrumentor.hpp"
+#include "pine/renderer/renderer_api.hpp"
+
+namespace pine
+{
+
+class OpenGLGPUInstrumentor : public GPUInstrumentor
+{
+    /*
+    Issues a pair of GL_TIMESTAMP queries per scope. Timestamps are used
+    instead of GL_TIME_ELAPSED since elapsed time queries can not be nested.
+    */
+
+    static constexpr uint32_t s_frame_latency = 4;
+    static constexpr uint32_t s_max_frame_scopes = 64;
+    static constexpr uint64_t s_calibration_interval = 256;
+
+    struct FrameQueries
+    {
+        std::array<const char*, s_max_frame_scopes> names = {};
+        uint32_t count = 0;
+        bool pending = false;
+        bool frame_scope = false; // The first scope spans the whole frame.
+    };
+
+public:
+    OpenGLGPUInstrumentor();
+    virtual ~OpenGLGPUInstrumentor();
+
+    virtual uint32_t BeginQuery(const char* name) override;
+    virtual void EndQuery(const uint32_t query) override;
+
+    virtual void BeginFrame() override;
+    virtual void EndFrame() override;
+
+    virtual float GetFrameTime() const override { return m_frame_time; }
+
+private:
+    static uint32_t get_start_query(const uint32_t frame, const uint32_t scope);
+
+    bool is_available(const uint32_t frame) const;
+    void resolve(const uint32_t frame);
+    void calibrate();
+
+private:
+    std::vector<RendererID> m_queries;
+    std::array<FrameQueries, s_frame_latency> m_frames = {};
+    uint32_t m_frame_index = 0;
+    uint64_t m_frame_count = 0;
+    int64_t m_clock_offset = 0;
+    std::atomic<float> m_frame_time = 0.0f;
+    uint64_t m_dropped_frames = 0;
+};
+
+} // namespace pine
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "pine/renderer/renderer_api.hpp"
+
+namespace pine
+{
+
+struct ProgramCacheHeader
+{
+    static constexpr std::array<char, 4> file_magic = {'P', 'P', 'R', 'G'};
+    static constexpr uint32_t file_version = 1;
+
+    std::array<char, 4> magic = file_magic;
+    uint32_t version = file_version;
+    uint64_t key = 0;
+    uint32_t binary_format = 0;
+    uint32_t binary_size = 0;
+};
+
+void set_program_cache_directory(const std::filesystem::path& directory);
+const std::filesystem::path& get_program_cache_directory();
+
+std::filesystem::path get_program_cache_path(const uint64_t key);
+
+// Hash (FNV-1a) of the shader sources and the driver vendor, renderer and
+// version, since program binaries are only valid for the driver that
+// created them. Requires a current context.
+uint64_t get_program_cache_key(
+    const std::unordered_map<uint32_t, std::string>& shader_sources);
+
+// Creates a program from a cached binary. Returns nothing if there is no
+// valid entry for the key, or if the driver rejects the binary.
+std::optional<RendererID> load_program_binary(const uint64_t key);
+
+// The program must have been linked with the retrievable binary hint. The
+// least recently used entries are evicted once the cache is full.
+bool write_program_binary(const RendererID program, const uint64_t key);
+
+} // namespace pine
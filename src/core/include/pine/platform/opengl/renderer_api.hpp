@@ -20,6 +20,19 @@ public:
 
     virtual void draw_indexed(const VertexArray& vertex_array,
         const uint32_t index_count = 0) override;
+    virtual void draw_indexed_indirect(const VertexArray& vertex_array,
+        const IndirectBuffer& indirect_buffer, const uint32_t draw_count,
+        const uint32_t first_draw = 0,
+        const RendererPrimitives primitive =
+            RendererPrimitives::Triangles) override;
+    virtual void draw_arrays_indirect(const VertexArray& vertex_array,
+        const IndirectBuffer& indirect_buffer, const uint32_t draw_count,
+        const uint32_t first_draw = 0,
+        const RendererPrimitives primitive =
+            RendererPrimitives::Triangles) override;
+    virtual void dispatch_compute(const uint32_t group_count_x,
+        const uint32_t group_count_y = 1,
+        const uint32_t group_count_z = 1) override;
 };
 
 } // namespace pine
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "pine/renderer/renderer_api.hpp"
 #include "pine/renderer/shader.hpp"
@@ -13,6 +19,8 @@ typedef unsigned int GLenum;
 namespace pine
 {
 
+class JobSystem;
+
 class OpenGLShader : public Shader
 {
 public:
@@ -21,6 +29,15 @@ public:
         const std::string& fragment_source);
     virtual ~OpenGLShader();
 
+    // Compiles the shaders together. All compiles and links are issued before
+    // the first status query, so that drivers with parallel shader
+    // compilation can compile them concurrently. Files are read and
+    // preprocessed on the job system, if one is given. Shaders that fail to
+    // load are logged and null.
+    static std::vector<std::unique_ptr<Shader>> create_batch(
+        const std::vector<std::filesystem::path>& filepaths,
+        JobSystem* job_system = nullptr);
+
     OpenGLShader(const OpenGLShader&) = delete;
     OpenGLShader(OpenGLShader&&) = default;
 
@@ -44,6 +61,14 @@ public:
         const Mat4& value) const override;
 
     virtual const std::string& get_name() const override { return m_name; }
+    virtual const std::filesystem::path& get_filepath() const override
+    {
+        return m_filepath;
+    }
+
+    virtual void reload_source() override;
+    virtual void update_reload() override;
+    virtual bool is_reloading() const override { return m_reloading; }
 
     void upload_uniform_int(const std::string& name, const int value) const;
     void upload_uniform_int_array(const std::string& name, const int* values,
@@ -61,15 +86,47 @@ public:
     void upload_uniform_mat4(const std::string& name, const Mat4& matrix) const;
 
 private:
-    std::string read_file(const std::filesystem::path& filepath);
-    std::unordered_map<GLenum, std::string> preprocess(
+    OpenGLShader() = default;
+
+    static std::string read_file(const std::filesystem::path& filepath);
+    // Splits the source into stages. Returns no stages if the source is
+    // invalid, which is logged.
+    static std::unordered_map<GLenum, std::string> preprocess(
         const std::string& source);
+
     void compile_shader(
         const std::unordered_map<GLenum, std::string>& shader_sources);
+    void begin_compile(
+        const std::unordered_map<GLenum, std::string>& shader_sources);
+    // Returns whether finish_compile can run without waiting for the driver.
+    bool is_compile_complete() const;
+    bool finish_compile();
+
+    int get_uniform_location(const std::string& name) const;
+
+    // Records the value uploaded to a uniform, and returns false if it is
+    // the same as the last one. Values are uploaded to the program directly,
+    // so that the record holds whichever program is bound.
+    bool update_uniform_value(const int location, const void* data,
+        const size_t size) const;
 
 private:
-    RendererID m_renderer_id;
+    RendererID m_renderer_id = 0;
     std::string m_name;
+    std::filesystem::path m_filepath;
+
+    // Compiled shaders, until the program has been checked.
+    std::vector<RendererID> m_pending_shaders;
+    uint64_t m_cache_key = 0;
+
+    // Hot reload, the sources are read on another thread.
+    std::mutex m_reload_mutex;
+    std::optional<std::unordered_map<GLenum, std::string>> m_reload_sources;
+    std::unique_ptr<OpenGLShader> m_reload_shader;
+    std::atomic<bool> m_reloading = false;
+
+    mutable std::unordered_map<std::string, int> m_uniform_locations;
+    mutable std::unordered_map<int, std::vector<uint8_t>> m_uniform_values;
 };
 
 } // namespace pine
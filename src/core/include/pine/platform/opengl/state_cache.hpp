@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "pine/renderer/renderer_api.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+class OpenGLStateCache
+{
+    /*
+    Shadows the bound objects and fixed function state of the context, and
+    skips calls that would not change it. Must only be used from the thread
+    that owns the context. Other code that changes the state, like the GUI
+    backend, has to restore it or call invalidate.
+    */
+
+    static constexpr uint32_t s_unknown = ~0u;
+    static constexpr uint32_t s_texture_unit_count = 32;
+
+    struct BufferBinding
+    {
+        uint32_t target;
+        RendererID buffer;
+    };
+
+    struct State
+    {
+        RendererID program = s_unknown;
+        RendererID vertex_array = s_unknown;
+        RendererID framebuffer = s_unknown;
+        // Element array buffers are part of the vertex array state, and are
+        // therefore not cached.
+        std::array<BufferBinding, 5> buffers = {};
+        std::array<RendererID, s_texture_unit_count> textures = {};
+        std::array<int32_t, 4> viewport = {};
+        int8_t blend = -1;
+        std::array<uint32_t, 2> blend_func = {};
+        int8_t depth_test = -1;
+        Vec4 clear_color = Vec4(-1.0f);
+    };
+
+public:
+    // Asserts that the calling thread may issue graphics calls. While a render
+    // thread runs, other threads have to go through RenderCommand::enqueue.
+    static void assert_context_thread();
+
+    // Forgets the shadowed state, so that the next calls are issued.
+    static void invalidate();
+
+    static void use_program(const RendererID program);
+    static void bind_vertex_array(const RendererID vertex_array);
+    static void bind_buffer(const uint32_t target, const RendererID buffer);
+    // Binds to an indexed binding point, which also binds the buffer to the
+    // generic target. The indexed bindings are not cached.
+    static void bind_buffer_base(const uint32_t target, const uint32_t index,
+        const RendererID buffer);
+    static void bind_texture_unit(const uint32_t unit,
+        const RendererID texture);
+    static void bind_framebuffer(const RendererID framebuffer);
+
+    static void set_viewport(const int32_t x, const int32_t y,
+        const int32_t width, const int32_t height);
+    static void set_blend(const bool enabled);
+    static void set_blend_func(const uint32_t source,
+        const uint32_t destination);
+    static void set_depth_test(const bool enabled);
+    static void set_clear_color(const Vec4& color);
+
+    // Names of deleted objects are reused, so they have to be forgotten.
+    static void forget_program(const RendererID program);
+    static void forget_vertex_array(const RendererID vertex_array);
+    static void forget_buffer(const RendererID buffer);
+    static void forget_texture(const RendererID texture);
+    static void forget_framebuffer(const RendererID framebuffer);
+
+private:
+    // Returns true if the value changed, and counts the state change.
+    template <typename T>
+    static bool update(T& current, const T& value);
+
+private:
+    static State s_state;
+};
+
+} // namespace pine
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pine/renderer/texture.hpp"
+#include "pine/renderer/texture_cache.hpp"
 
 namespace pine
 {
@@ -9,7 +10,10 @@ class OpenGLTexture2D : public Texture2D
 {
 public:
     OpenGLTexture2D(const std::filesystem::path& imagePath);
-    OpenGLTexture2D(const Image& image);
+    OpenGLTexture2D(const Image& image,
+        const TextureFilter filter = TextureFilter::NEAREST);
+    OpenGLTexture2D(const MappedTextureFile& file,
+        const std::filesystem::path& source_path);
 
     ~OpenGLTexture2D();
 
@@ -26,12 +30,44 @@ public:
 
     virtual bool operator==(const Texture& other) const override;
 
+    virtual void set_image(const Image& image) override;
+
 private:
     RendererID m_renderer_id;
     std::filesystem::path m_source;
     Image m_image;
     uint32_t m_width;
     uint32_t m_height;
+    uint64_t m_memory_size = 0;
+    TextureFilter m_filter = TextureFilter::NEAREST;
+};
+
+class OpenGLIndexTexture2D : public IndexTexture2D
+{
+public:
+    OpenGLIndexTexture2D(const uint32_t width, const uint32_t height);
+    ~OpenGLIndexTexture2D();
+
+    virtual uint32_t get_width() const override { return m_width; }
+    virtual uint32_t get_height() const override { return m_height; }
+
+    virtual RendererID get_renderer_id() const override
+    {
+        return m_renderer_id;
+    }
+
+    virtual void bind(const uint32_t slot = 0) const override;
+    virtual void unbind() const override;
+
+    virtual bool operator==(const Texture& other) const override;
+
+    virtual void set_data(const uint16_t* indices) override;
+
+private:
+    RendererID m_renderer_id;
+    uint32_t m_width;
+    uint32_t m_height;
+    uint64_t m_memory_size = 0;
 };
 
 } // namespace pine
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "pine/debug/gpu_instrumentor.hpp"
+#include "pine/renderer/buffer.hpp"
+#include "pine/renderer/render_command.hpp"
+#include "pine/renderer/shader.hpp"
+
+namespace pine
+{
+
+// Shared submission of the batch renderers, e.g. quads, lines and text.
+namespace BatchRenderer
+{
+// Uploads the vertices of a batch to the vertex buffer of the vertex array.
+// The vertices are staged for the render thread, since the batch renderers
+// overwrite them with the next batch.
+void upload(const VertexArray& vertex_array, const void* vertices,
+    const size_t size);
+
+// Binds the shader and draws the batch on the render thread. The bind
+// function binds the other resources of the batch, and its captures keep
+// them alive until the batch has been drawn. The name is the GPU profiling
+// scope and must outlive the frame, e.g. a string literal.
+template <typename BindFunction>
+void draw(const char* name, const Shader& shader,
+    const VertexArray& vertex_array, const uint32_t index_count,
+    BindFunction&& bind)
+{
+    RenderCommand::enqueue(
+        [name,
+            shader = &shader,
+            vertex_array = &vertex_array,
+            index_count,
+            bind = std::forward<BindFunction>(bind)]()
+        {
+            PINE_PROFILE_GPU_SCOPE(name);
+            shader->bind();
+            bind();
+            RenderCommand::draw_indexed(*vertex_array, index_count);
+        });
+}
+
+inline void draw(const char* name, const Shader& shader,
+    const VertexArray& vertex_array, const uint32_t index_count)
+{
+    draw(name, shader, vertex_array, index_count, []() {});
+}
+} // namespace BatchRenderer
+
+} // namespace pine
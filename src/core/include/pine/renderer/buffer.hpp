@@ -88,7 +88,9 @@ public:
     virtual void bind() const = 0;
     virtual void unbind() const = 0;
 
-    virtual void set_data(const void* data, const uint32_t size) = 0;
+    // The offset is in bytes.
+    virtual void set_data(const void* data, const uint32_t size,
+        const uint32_t offset = 0) = 0;
 
     virtual const VertexBufferLayout& get_layout() const = 0;
     virtual void set_layout(const VertexBufferLayout& layout) = 0;
@@ -108,10 +110,91 @@ public:
 
     virtual uint32_t get_count() const = 0;
 
+    // The offset is in indices.
+    virtual void set_data(const uint32_t* indices, const uint32_t count,
+        const uint32_t offset = 0) = 0;
+
+    // Creates an empty buffer for the count of indices.
+    static std::unique_ptr<IndexBuffer> create(const uint32_t count);
     static std::unique_ptr<IndexBuffer> create(const uint32_t* indices,
         const uint32_t count);
 };
 
+class UniformBuffer
+{
+public:
+    virtual ~UniformBuffer() = default;
+
+    virtual void set_data(const void* data, const uint32_t size,
+        const uint32_t offset = 0) = 0;
+
+    virtual uint32_t get_binding() const = 0;
+
+    // The buffer is bound to the uniform block binding point, which shaders
+    // select with layout(binding = ...).
+    static std::unique_ptr<UniformBuffer> create(const uint32_t size,
+        const uint32_t binding);
+};
+
+class StorageBuffer
+{
+public:
+    virtual ~StorageBuffer() = default;
+
+    // Binds the buffer to its shader storage binding point again, in case
+    // another buffer has taken it.
+    virtual void bind() const = 0;
+
+    virtual void set_data(const void* data, const uint32_t size,
+        const uint32_t offset = 0) = 0;
+
+    virtual uint32_t get_size() const = 0;
+    virtual uint32_t get_binding() const = 0;
+
+    // Shaders select the binding point with layout(std430, binding = ...).
+    static std::unique_ptr<StorageBuffer> create(const uint32_t size,
+        const uint32_t binding);
+};
+
+// Arguments of one indexed draw, in the layout of the graphics API.
+struct DrawIndexedIndirectCommand
+{
+    uint32_t index_count = 0;
+    uint32_t instance_count = 0;
+    uint32_t first_index = 0;
+    int32_t base_vertex = 0;
+    uint32_t base_instance = 0;
+};
+
+// Arguments of one non-indexed draw, in the layout of the graphics API.
+struct DrawArraysIndirectCommand
+{
+    uint32_t count = 0;
+    uint32_t instance_count = 0;
+    uint32_t first = 0;
+    uint32_t base_instance = 0;
+};
+
+class IndirectBuffer
+{
+public:
+    virtual ~IndirectBuffer() = default;
+
+    virtual void bind() const = 0;
+    // Binds the buffer to a shader storage binding point, for compute
+    // shaders that write the draw commands.
+    virtual void bind_base(const uint32_t binding) const = 0;
+
+    // The size and offset are in bytes, as the buffer may hold either type
+    // of draw command.
+    virtual void set_data(const void* data, const uint32_t size,
+        const uint32_t offset = 0) = 0;
+
+    virtual uint32_t get_size() const = 0;
+
+    static std::unique_ptr<IndirectBuffer> create(const uint32_t size);
+};
+
 class VertexArray
 {
 public:
@@ -129,4 +212,7 @@ public:
     static std::unique_ptr<VertexArray> create();
 };
 
+// Indices of quads with four vertices each, as two triangles per quad.
+std::vector<uint32_t> create_quad_indices(const uint32_t quad_count);
+
 } // namespace pine
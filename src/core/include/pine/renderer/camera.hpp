@@ -100,4 +100,115 @@ private:
     float camera_rotation_speed = 1.0f;
 };
 
+class PerspectiveCamera
+{
+    /*
+    Camera with a perspective projection and a right handed, y up frame. The
+    orientation is a yaw about the y axis followed by a pitch about the x
+    axis, and the camera looks along the negative z axis at zero angles.
+    */
+
+public:
+    // The field of view is vertical, in radians.
+    PerspectiveCamera(const float field_of_view, const float aspect_ratio,
+        const float near_clip, const float far_clip);
+
+    void set_projection(const float field_of_view, const float aspect_ratio,
+        const float near_clip, const float far_clip);
+
+    void set_position(const Vec3& position_)
+    {
+        position = position_;
+        update_view_matrix();
+    }
+
+    // Angles in radians.
+    void set_orientation(const float yaw_, const float pitch_)
+    {
+        yaw = yaw_;
+        pitch = pitch_;
+        update_view_matrix();
+    }
+
+    const Vec3& get_position() const { return position; }
+    float get_yaw() const { return yaw; }
+    float get_pitch() const { return pitch; }
+
+    Vec3 get_forward_direction() const;
+    Vec3 get_right_direction() const;
+    Vec3 get_up_direction() const;
+
+    const Mat4& get_projection_matrix() const { return projection_matrix; }
+    const Mat4& get_view_matrix() const { return view_matrix; }
+
+    Mat4 calculate_view_projection_matrix() const
+    {
+        return projection_matrix * view_matrix;
+    }
+
+private:
+    Quat get_orientation() const;
+    void update_view_matrix();
+
+private:
+    Mat4 projection_matrix;
+    Mat4 view_matrix;
+
+    Vec3 position = {0.0f, 0.0f, 0.0f};
+    float yaw = 0.0f;
+    float pitch = 0.0f;
+};
+
+class PerspectiveCameraController
+{
+    /*
+    First person controller that moves the camera along its own axes. The
+    mouse wheel changes the speed.
+    */
+
+public:
+    PerspectiveCameraController(const float aspect_ratio,
+        const float field_of_view = radians(45.0f));
+
+    void on_event(Event& event);
+
+    void move_forward(const Timestep& ts);
+    void move_backward(const Timestep& ts);
+    void move_left(const Timestep& ts);
+    void move_right(const Timestep& ts);
+    void move_up(const Timestep& ts);
+    void move_down(const Timestep& ts);
+
+    void turn_left(const Timestep& ts);
+    void turn_right(const Timestep& ts);
+    void look_up(const Timestep& ts);
+    void look_down(const Timestep& ts);
+
+    void on_resize(const float width, const float height);
+
+    PerspectiveCamera& get_camera() { return camera; }
+    const PerspectiveCamera& get_camera() const { return camera; }
+
+    void set_position(const Vec3& position);
+    void set_orientation(const float yaw, const float pitch);
+
+private:
+    bool on_mouse_scrolled(const MouseScrolledEvent& event);
+    bool on_window_resized(const WindowResizeEvent& event);
+
+    void move(const Vec3& direction, const Timestep& ts);
+    void turn(const float yaw_delta, const float pitch_delta);
+
+private:
+    float aspect_ratio;
+    float field_of_view; // Vertical field of view in radians.
+    float near_clip = 0.1f;
+    float far_clip = 1000.0f;
+
+    PerspectiveCamera camera;
+
+    float camera_linear_speed = 5.0f;
+    float camera_rotation_speed = 1.5f; // Radians per second.
+};
+
 } // namespace pine
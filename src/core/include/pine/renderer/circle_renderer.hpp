@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "pine/renderer/buffer.hpp"
+#include "pine/renderer/shader.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+// Circles are quads, which the fragment shader cuts out with the distance to
+// the center in local coordinates.
+struct CircleVertex
+{
+    Vec3 position = {};
+    Vec2 local_position = {};
+    Vec4 color = {};
+    float thickness = {};
+    float fade = {};
+};
+
+struct CircleRenderCaps
+{
+    static constexpr uint32_t max_circles = 20000;
+    static constexpr uint32_t vertices_per_circle = 4;
+    static constexpr uint32_t indices_per_circle = 6;
+    static constexpr uint32_t max_vertices = max_circles * vertices_per_circle;
+    static constexpr uint32_t max_indices = max_circles * indices_per_circle;
+};
+
+struct CircleRenderStatistics
+{
+    uint32_t draw_calls = 0;
+    uint32_t circle_count = 0;
+
+    uint32_t get_total_vertex_count()
+    {
+        return circle_count * CircleRenderCaps::vertices_per_circle;
+    }
+
+    uint32_t get_total_index_count()
+    {
+        return circle_count * CircleRenderCaps::indices_per_circle;
+    }
+};
+
+struct CircleRenderData
+{
+    std::shared_ptr<Shader> circle_shader = {};
+    std::unique_ptr<VertexArray> circle_vertex_array = {};
+
+    std::array<CircleVertex, CircleRenderCaps::max_vertices> circle_vertices{};
+
+    uint32_t circle_vertex_count = 0;
+    uint32_t circle_index_count = 0;
+
+    CircleRenderStatistics statistics{};
+}; // CircleRenderData
+
+namespace CircleRenderer
+{
+// Loads the circle shader unless one is given, e.g. from a shader library.
+CircleRenderData init(const std::shared_ptr<Shader>& circle_shader = nullptr);
+void shutdown(CircleRenderData& data);
+
+// Uses the camera of Renderer::begin_scene.
+void begin_scene(CircleRenderData& data);
+void end_scene(CircleRenderData& data);
+
+void flush(CircleRenderData& data);
+void flush_and_reset(CircleRenderData& data);
+
+// The thickness is a fraction of the radius, one fills the circle. The fade
+// softens the edges, also as a fraction of the radius.
+void draw_circle(CircleRenderData& data, const Vec2& position,
+    const float radius, const Vec4& color, const float thickness = 1.0f,
+    const float fade = 0.005f);
+void draw_circle(CircleRenderData& data, const Vec3& position,
+    const float radius, const Vec4& color, const float thickness = 1.0f,
+    const float fade = 0.005f);
+// Fits the circle into the unit quad of the transform.
+void draw_circle(CircleRenderData& data, const Mat4& transform,
+    const Vec4& color, const float thickness = 1.0f,
+    const float fade = 0.005f);
+} // namespace CircleRenderer
+
+} // namespace pine
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <memory>
+
+#include "pine/renderer/texture.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+// Glyph metrics are in units of the line height, relative to the pen
+// position on the baseline.
+struct Glyph
+{
+    Vec2 min = {};
+    Vec2 max = {};
+    Vec2 texture_min = {};
+    Vec2 texture_max = {};
+    float advance = 0.0f;
+};
+
+class Font
+{
+    /*
+    Signed distance field glyph atlas of a TrueType font, for the printable
+    ASCII characters. The distance fields keep the edges sharp at any text
+    size, so one atlas serves all sizes.
+    */
+
+public:
+    static constexpr char first_character = ' ';
+    static constexpr char last_character = '~';
+    static constexpr uint32_t glyph_count =
+        static_cast<uint32_t>(last_character - first_character + 1);
+
+    // The glyph size is the line height of the rasterized glyphs in pixels.
+    Font(const std::filesystem::path& filepath, const float glyph_size = 48.0f);
+
+    Font(const Font&) = delete;
+    Font(Font&&) = delete;
+
+    Font& operator=(const Font&) = delete;
+    Font& operator=(Font&&) = delete;
+
+    bool is_loaded() const { return m_atlas != nullptr; }
+
+    // Characters outside of the atlas are drawn as question marks.
+    const Glyph& get_glyph(const char character) const;
+    float get_kerning(const char first, const char second) const;
+
+    // Distance between baselines, as a fraction of the line height.
+    float get_line_spacing() const { return m_line_spacing; }
+    // Height of the ascent above the baseline.
+    float get_ascent() const { return m_ascent; }
+
+    const std::shared_ptr<Texture2D>& get_atlas() const { return m_atlas; }
+
+private:
+    static uint32_t get_index(const char character);
+
+private:
+    std::array<Glyph, glyph_count> m_glyphs = {};
+    std::array<float, glyph_count * glyph_count> m_kerning = {};
+    float m_line_spacing = 1.0f;
+    float m_ascent = 0.0f;
+    std::shared_ptr<Texture2D> m_atlas;
+};
+
+} // namespace pine
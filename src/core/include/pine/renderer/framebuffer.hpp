@@ -1,25 +1,73 @@
 #pragma once
 
 #include <cstdint>
+#include <initializer_list>
 #include <memory>
+#include <vector>
 
 #include "pine/core/common.hpp"
+#include "pine/renderer/image.hpp"
 #include "pine/renderer/renderer_api.hpp"
 
 namespace pine
 {
 
+enum class FramebufferTextureFormat : uint8_t
+{
+    NONE,
+    // Color.
+    RGBA8,
+    RGBA16F,
+    R32UI, // E.g. entity IDs for picking.
+    // Depth and stencil.
+    DEPTH24_STENCIL8
+};
+
+struct FramebufferAttachmentSpecs
+{
+    FramebufferTextureFormat format = FramebufferTextureFormat::NONE;
+    // Attachments that are never sampled, e.g. most depth buffers, are
+    // created as render buffers.
+    bool sampled = true;
+
+    FramebufferAttachmentSpecs() = default;
+    FramebufferAttachmentSpecs(const FramebufferTextureFormat format,
+        const bool sampled = true)
+        : format(format), sampled(sampled)
+    {
+    }
+};
+
+struct FramebufferFormat
+{
+    std::vector<FramebufferAttachmentSpecs> attachments;
+
+    FramebufferFormat() = default;
+    FramebufferFormat(
+        std::initializer_list<FramebufferAttachmentSpecs> attachments)
+        : attachments(attachments)
+    {
+    }
+};
+
 struct FramebufferSpecs
 {
     uint32_t width = 0;
     uint32_t height = 0;
+    // Multisampled attachments are resolved when the framebuffer is unbound.
     uint32_t samples = 1;
 
-    bool swapchain_target = false;
+    FramebufferFormat format = {FramebufferTextureFormat::RGBA8,
+        {FramebufferTextureFormat::DEPTH24_STENCIL8, false}};
 
-    // TODO: FramebufferFormat
+    bool swapchain_target = false;
 };
 
+constexpr bool is_depth_format(const FramebufferTextureFormat format)
+{
+    return format == FramebufferTextureFormat::DEPTH24_STENCIL8;
+}
+
 class Framebuffer
 {
 public:
@@ -30,9 +78,30 @@ public:
 
     virtual void resize(const uint32_t width, const uint32_t height) = 0;
 
-    virtual RendererID get_color_attachment_renderer_id() const = 0;
+    // The index counts color attachments only, in the order of the format.
+    virtual RendererID get_color_attachment_renderer_id(
+        const uint32_t index = 0) const = 0;
+
+    // Reads the first color attachment back to the CPU as 8 bit RGBA, e.g.
+    // for frame capture. The attachment must be a sampled RGBA8 or RGBA16F
+    // one.
+    virtual Image read_color_attachment() const = 0;
+
+    // Reads a single pixel of an R32UI color attachment, e.g. for picking.
+    virtual uint32_t read_pixel(const uint32_t index, const uint32_t x,
+        const uint32_t y) const = 0;
+
+    // Clears an R32UI color attachment to a value, e.g. an invalid ID.
+    virtual void clear_attachment(const uint32_t index,
+        const uint32_t value) = 0;
 
     virtual const FramebufferSpecs& get_specification() const = 0;
+
+    // Size of the attachments, which may be larger than the specified size.
+    // Only the specified size is rendered to, starting at the origin.
+    virtual uint32_t get_capacity_width() const = 0;
+    virtual uint32_t get_capacity_height() const = 0;
+
     static std::unique_ptr<Framebuffer> create(
         const FramebufferSpecs& specs);
 };
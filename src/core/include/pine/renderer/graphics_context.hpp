@@ -13,6 +13,11 @@ public:
     virtual void init() = 0;
     virtual void swap_buffers() = 0;
 
+    // Binds the context to the calling thread, or unbinds it, so that it can
+    // be handed over to another thread.
+    virtual void make_current() = 0;
+    virtual void release() = 0;
+
     static std::unique_ptr<GraphicsContext> create(void* window);
 };
 
@@ -3,6 +3,8 @@
 #include <filesystem>
 #include <vector>
 
+#include "pine/debug/memory_tracker.hpp"
+
 namespace pine
 {
 
@@ -22,7 +24,8 @@ enum class ImageFileFormat : uint8_t
     JPG,
     PNG,
     BMP,
-    TGA
+    TGA,
+    QOI
 };
 
 enum class ImageFormat : uint8_t
@@ -38,7 +41,8 @@ enum class ImageFormat : uint8_t
 
 struct Image
 {
-    using BufferType = std::vector<uint8_t>;
+    using BufferType =
+        std::vector<uint8_t, TrackingAllocator<uint8_t, MemoryTag::IMAGE>>;
 
 public:
     Image() = default;
@@ -56,7 +60,9 @@ public:
     uint32_t get_width() const { return width; }
     uint32_t get_height() const { return height; }
     ImageFormat get_format() const { return format; }
-    const BufferType get_buffer() const { return buffer; }
+    const BufferType& get_buffer() const { return buffer; }
+
+    void flip_vertically();
 
 private:
     uint32_t width = 0;
@@ -71,7 +77,8 @@ Image read_image(const std::filesystem::path& filepath,
 Image read_image(const std::filesystem::path& filepath,
     const ImageFormat format, const bool flip = false);
 
+// Quality is only used for JPG and ranges from 1 to 100.
 bool write_image(const std::filesystem::path& filepath, const Image& image,
-    const bool flip = false);
+    const bool flip = false, const int quality = 100);
 
 } // namespace pine
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "pine/renderer/image.hpp"
+
+namespace pine
+{
+
+enum class ImageWriterPolicy : uint8_t
+{
+    DROP, // Discard new images when the queue is full.
+    BLOCK // Wait for a free slot when the queue is full.
+};
+
+struct ImageWriterSpecs
+{
+    uint32_t worker_count = 2;
+    uint32_t queue_capacity = 8;
+    ImageWriterPolicy policy = ImageWriterPolicy::DROP;
+    int quality = 90;
+};
+
+struct ImageWriterStats
+{
+    uint64_t submitted = 0;
+    uint64_t written = 0;
+    uint64_t dropped = 0;
+    uint64_t failed = 0;
+};
+
+class ImageWriter
+{
+    /*
+    Encodes and writes images on a pool of worker threads. Submitting an
+    image only moves it into a bounded queue, so frame captures can be
+    recorded without stalling the render loop.
+    */
+
+    struct WriteJob
+    {
+        std::filesystem::path filepath;
+        Image image;
+        bool flip = false;
+    };
+
+public:
+    ImageWriter(const ImageWriterSpecs& specs = ImageWriterSpecs());
+    ~ImageWriter();
+
+    ImageWriter(const ImageWriter&) = delete;
+    ImageWriter(ImageWriter&&) = delete;
+
+    ImageWriter& operator=(const ImageWriter&) = delete;
+    ImageWriter& operator=(ImageWriter&&) = delete;
+
+    // Returns false if the image was dropped.
+    bool submit(const std::filesystem::path& filepath, Image&& image,
+        const bool flip = false);
+
+    // Blocks until all submitted images have been written.
+    void wait_idle();
+
+    uint64_t get_pending_count() const;
+    ImageWriterStats get_stats() const;
+    const ImageWriterSpecs& get_specification() const { return m_specs; }
+
+private:
+    void run_worker();
+
+private:
+    ImageWriterSpecs m_specs;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_job_available;
+    std::condition_variable m_slot_available;
+    std::condition_variable m_idle;
+
+    std::deque<WriteJob> m_jobs;
+    std::vector<std::thread> m_workers;
+    uint32_t m_active_jobs = 0;
+    bool m_stopping = false;
+
+    std::atomic<uint64_t> m_submitted = 0;
+    std::atomic<uint64_t> m_written = 0;
+    std::atomic<uint64_t> m_dropped = 0;
+    std::atomic<uint64_t> m_failed = 0;
+};
+
+} // namespace pine
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "pine/renderer/buffer.hpp"
+#include "pine/renderer/shader.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+// Each line is a quad that the shader expands in screen space. The vertices
+// of a line hold both end points, and the side of the line they belong to.
+struct LineVertex
+{
+    Vec3 position = {};
+    Vec3 other_position = {};
+    Vec4 color = {};
+    float side = {};
+    float width = {};
+};
+
+struct LineRenderCaps
+{
+    static constexpr uint32_t max_lines = 20000;
+    static constexpr uint32_t vertices_per_line = 4;
+    static constexpr uint32_t indices_per_line = 6;
+    static constexpr uint32_t max_vertices = max_lines * vertices_per_line;
+    static constexpr uint32_t max_indices = max_lines * indices_per_line;
+};
+
+struct LineRenderStatistics
+{
+    uint32_t draw_calls = 0;
+    uint32_t line_count = 0;
+
+    uint32_t get_total_vertex_count()
+    {
+        return line_count * LineRenderCaps::vertices_per_line;
+    }
+
+    uint32_t get_total_index_count()
+    {
+        return line_count * LineRenderCaps::indices_per_line;
+    }
+};
+
+struct LineRenderData
+{
+    std::shared_ptr<Shader> line_shader = {};
+    std::unique_ptr<VertexArray> line_vertex_array = {};
+
+    std::array<LineVertex, LineRenderCaps::max_vertices> line_vertices{};
+
+    uint32_t line_vertex_count = 0;
+    uint32_t line_index_count = 0;
+
+    LineRenderStatistics statistics{};
+}; // LineRenderData
+
+namespace LineRenderer
+{
+// Loads the line shader unless one is given, e.g. from a shader library.
+LineRenderData init(const std::shared_ptr<Shader>& line_shader = nullptr);
+void shutdown(LineRenderData& data);
+
+// Uses the camera of Renderer::begin_scene.
+void begin_scene(LineRenderData& data);
+void end_scene(LineRenderData& data);
+
+void flush(LineRenderData& data);
+void flush_and_reset(LineRenderData& data);
+
+// Widths are in pixels.
+void draw_line(LineRenderData& data, const Vec2& start, const Vec2& end,
+    const Vec4& color, const float width = 1.0f);
+void draw_line(LineRenderData& data, const Vec3& start, const Vec3& end,
+    const Vec4& color, const float width = 1.0f);
+
+void draw_rect(LineRenderData& data, const Vec3& position, const Vec2& size,
+    const Vec4& color, const float width = 1.0f);
+// Outlines the unit quad of the transform, like QuadRenderer::draw_quad.
+void draw_rect(LineRenderData& data, const Mat4& transform, const Vec4& color,
+    const float width = 1.0f);
+} // namespace LineRenderer
+
+} // namespace pine
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "pine/renderer/buffer.hpp"
+#include "pine/renderer/common.hpp"
+#include "pine/renderer/shader.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+struct MeshVertex
+{
+    Vec3 position = {};
+    Vec3 normal = {};
+    Vec4 color = {};
+};
+
+// Vertices and indices of a mesh before it is uploaded. Point meshes, like
+// point clouds, index each of their vertices once and have no normals.
+struct MeshData
+{
+    std::vector<MeshVertex> vertices = {};
+    std::vector<uint32_t> indices = {};
+    RendererPrimitives primitive = RendererPrimitives::Triangles;
+};
+
+using MeshID = uint32_t;
+
+// Per draw data of the mesh shader, in std430 layout.
+struct MeshDrawData
+{
+    Mat4 transform = Mat4(1.0f);
+    Vec4 color = Vec4(1.0f);
+};
+
+// Location of an uploaded mesh in the shared buffers.
+struct MeshRange
+{
+    uint32_t first_index = 0;
+    uint32_t index_count = 0;
+    int32_t base_vertex = 0;
+    RendererPrimitives primitive = RendererPrimitives::Triangles;
+};
+
+struct MeshRenderCaps
+{
+    static constexpr uint32_t max_vertices = 1 << 20;
+    static constexpr uint32_t max_indices = 1 << 22;
+    static constexpr uint32_t max_draws = 1 << 16;
+    // Shader storage binding point of the draw data.
+    static constexpr uint32_t draw_binding = 0;
+    static constexpr MeshID invalid_mesh = ~0u;
+};
+
+struct MeshRenderStatistics
+{
+    uint32_t draw_calls = 0;
+    uint32_t object_count = 0;
+    uint32_t mesh_count = 0;
+    uint32_t vertex_count = 0;
+    uint32_t index_count = 0;
+};
+
+struct MeshRenderData
+{
+    std::shared_ptr<Shader> mesh_shader = {};
+    // Vertex and index buffers that hold all uploaded meshes.
+    std::unique_ptr<VertexArray> mesh_vertex_array = {};
+    std::unique_ptr<StorageBuffer> draw_buffer = {};
+    std::unique_ptr<IndirectBuffer> indirect_buffer = {};
+
+    std::vector<MeshRange> meshes = {};
+    uint32_t mesh_vertex_count = 0;
+    uint32_t mesh_index_count = 0;
+
+    // Draws of the current batch. The commands index the draw data with
+    // their base instance.
+    std::vector<MeshDrawData> draws = {};
+    std::vector<DrawIndexedIndirectCommand> triangle_commands = {};
+    std::vector<DrawIndexedIndirectCommand> point_commands = {};
+
+    MeshRenderStatistics statistics{};
+}; // MeshRenderData
+
+namespace MeshRenderer
+{
+// Loads the mesh shader unless one is given, e.g. from a shader library.
+MeshRenderData init(const std::shared_ptr<Shader>& mesh_shader = nullptr);
+void shutdown(MeshRenderData& data);
+
+// Copies the mesh into the shared buffers. Returns invalid_mesh if the mesh
+// does not fit.
+MeshID upload_mesh(MeshRenderData& data, const MeshData& mesh);
+
+// Uses the camera of Renderer::begin_scene.
+void begin_scene(MeshRenderData& data);
+void end_scene(MeshRenderData& data);
+
+// Draws the batch with one indirect multi-draw call per primitive type.
+void flush(MeshRenderData& data);
+void flush_and_reset(MeshRenderData& data);
+
+void draw_mesh(MeshRenderData& data, const MeshID mesh, const Mat4& transform,
+    const Vec4& color = Vec4(1.0f));
+} // namespace MeshRenderer
+
+// Unit cube around the origin, with normals per face.
+MeshData create_cube_mesh(const Vec4& color = Vec4(1.0f));
+
+} // namespace pine
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+class JobSystem;
+
+struct PointCloudVertex
+{
+    Vec3 position = {};
+    // RGBA with 8 bits per channel, red in the lowest byte.
+    uint32_t color = 0xffffffff;
+};
+
+// Octree node in std430 layout, as read by the culling shader.
+struct PointCloudNode
+{
+    Vec3 min = {};
+    // Distance between the points of the node, which halves with each level.
+    float spacing = 0.0f;
+    Vec3 max = {};
+    uint32_t parent = ~0u;
+    uint32_t first_point = 0;
+    uint32_t point_count = 0;
+    std::array<uint32_t, 2> padding = {};
+};
+
+static_assert(sizeof(PointCloudNode) == 48, "Node must match std430 layout.");
+
+class PointCloud
+{
+    /*
+    Points of a PLY file, sorted into an octree for level of detail. Each
+    inner node keeps one point per cell of a grid over its region, and passes
+    the other points on to its children. The points of a node are contiguous,
+    and a node adds detail to its ancestors rather than replacing them.
+    */
+
+public:
+    // Cells along each side of the sampling grid of a node.
+    static constexpr uint32_t grid_resolution = 64;
+    // Nodes with fewer points than this are not split.
+    static constexpr uint32_t max_leaf_points = 8192;
+    static constexpr uint32_t max_depth = 16;
+    static constexpr uint32_t invalid_node = ~0u;
+
+    PointCloud() = default;
+
+    PointCloud(const PointCloud&) = delete;
+    PointCloud(PointCloud&&) = delete;
+
+    PointCloud& operator=(const PointCloud&) = delete;
+    PointCloud& operator=(PointCloud&&) = delete;
+
+    // Reads the file and builds the octree in a job, which keeps the point
+    // cloud alive until it has finished. The point cloud is empty until it
+    // is loaded.
+    static std::shared_ptr<PointCloud> load(
+        const std::filesystem::path& filepath, JobSystem& job_system);
+
+    bool is_loaded() const { return m_loaded.load(std::memory_order_acquire); }
+    // False once the job has finished, even if the file could not be read.
+    bool is_loading() const
+    {
+        return m_loading.load(std::memory_order_acquire);
+    }
+
+    const std::vector<PointCloudVertex>& get_points() const { return m_points; }
+
+    // Nodes are sorted by level, starting with the root. The nodes of level
+    // n are in [level_offsets[n], level_offsets[n + 1]).
+    const std::vector<PointCloudNode>& get_nodes() const { return m_nodes; }
+    const std::vector<uint32_t>& get_level_offsets() const
+    {
+        return m_level_offsets;
+    }
+    uint32_t get_level_count() const
+    {
+        return m_level_offsets.empty()
+            ? 0
+            : static_cast<uint32_t>(m_level_offsets.size() - 1);
+    }
+
+private:
+    void build(std::vector<PointCloudVertex> points);
+
+private:
+    std::atomic<bool> m_loading = false;
+    std::atomic<bool> m_loaded = false;
+
+    std::vector<PointCloudVertex> m_points;
+    std::vector<PointCloudNode> m_nodes;
+    std::vector<uint32_t> m_level_offsets;
+};
+
+} // namespace pine
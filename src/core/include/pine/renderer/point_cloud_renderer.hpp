@@ -0,0 +1,97 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "pine/renderer/buffer.hpp"
+#include "pine/renderer/camera.hpp"
+#include "pine/renderer/point_cloud.hpp"
+#include "pine/renderer/shader.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+struct PointCloudRenderCaps
+{
+    // Invocations per work group of the culling shader.
+    static constexpr uint32_t workgroup_size = 64;
+    // Shader storage binding points of the culling shader.
+    static constexpr uint32_t node_binding = 1;
+    static constexpr uint32_t refine_binding = 2;
+    static constexpr uint32_t counter_binding = 3;
+    static constexpr uint32_t command_binding = 4;
+};
+
+struct PointCloudRenderStatistics
+{
+    uint32_t draw_calls = 0;
+    uint32_t dispatch_count = 0;
+    uint32_t point_count = 0;
+    uint32_t node_count = 0;
+    uint32_t level_count = 0;
+};
+
+// Buffers sized for the uploaded point cloud. They are created by the upload
+// command, so they are only accessed by commands.
+struct PointCloudBuffers
+{
+    // Points of the uploaded point cloud, sorted by node.
+    std::unique_ptr<VertexArray> point_vertex_array = {};
+    std::unique_ptr<StorageBuffer> node_buffer = {};
+    // Whether the children of each node are to be drawn, written by the
+    // culling shader for the next level.
+    std::unique_ptr<StorageBuffer> refine_buffer = {};
+    // One draw command per node, written by the culling shader.
+    std::unique_ptr<IndirectBuffer> command_buffer = {};
+};
+
+struct PointCloudRenderData
+{
+    std::shared_ptr<Shader> point_shader = {};
+    std::shared_ptr<Shader> cull_shader = {};
+
+    std::unique_ptr<PointCloudBuffers> buffers = {};
+    // Points that have been claimed from the budget this frame.
+    std::unique_ptr<StorageBuffer> counter_buffer = {};
+
+    std::vector<uint32_t> level_offsets = {};
+
+    // Projection of the scene, for the screen space size of the nodes.
+    Vec3 camera_position = {};
+    float projection_scale = 1.0f;
+
+    // Upper bound of the points drawn per frame. Coarse levels are served
+    // first, so the budget limits the detail rather than the extent.
+    uint32_t point_budget = 2000000;
+    // Nodes are refined while their point spacing on screen is larger than
+    // the threshold, in pixels.
+    float error_threshold = 2.0f;
+
+    PointCloudRenderStatistics statistics{};
+}; // PointCloudRenderData
+
+namespace PointCloudRenderer
+{
+// Loads the shaders unless they are given, e.g. from a shader library.
+PointCloudRenderData init(const std::shared_ptr<Shader>& point_shader = nullptr,
+    const std::shared_ptr<Shader>& cull_shader = nullptr);
+void shutdown(PointCloudRenderData& data);
+
+// Replaces the uploaded point cloud, and the buffers with ones of its size.
+// Returns false if the point cloud is not loaded, is empty or is too large
+// for the buffers, in which case the previous one is kept.
+bool upload_point_cloud(PointCloudRenderData& data,
+    const std::shared_ptr<PointCloud>& point_cloud);
+
+// Uses the camera of Renderer::begin_scene, which must be the given one.
+void begin_scene(PointCloudRenderData& data, const PerspectiveCamera& camera);
+
+// Selects the nodes of the uploaded point cloud on the GPU, one dispatch per
+// level, and draws them with a single indirect multi-draw call. Nodes
+// outside of the view, nodes with parents that are detailed enough and nodes
+// beyond the budget are drawn with zero points.
+void draw_point_cloud(PointCloudRenderData& data);
+} // namespace PointCloudRenderer
+
+} // namespace pine
@@ -61,7 +61,7 @@ struct QuadRenderStatistics
 
 struct QuadRenderData
 {
-    std::unique_ptr<Shader> quad_shader = {};
+    std::shared_ptr<Shader> quad_shader = {};
     std::unique_ptr<VertexArray> quad_vertex_array = {};
 
     std::array<std::shared_ptr<Texture2D>, QuadRenderCaps::max_texture_slots>
@@ -77,9 +77,12 @@ struct QuadRenderData
 
 namespace QuadRenderer
 {
-QuadRenderData init();
+// Loads the quad shader unless one is given, e.g. from a shader library.
+QuadRenderData init(const std::shared_ptr<Shader>& quad_shader = nullptr);
 void shutdown(QuadRenderData& data);
 
+// Uses the camera of Renderer::begin_scene.
+void begin_scene(QuadRenderData& data);
 void begin_scene(QuadRenderData& data, const OrthographicCamera& camera);
 void end_scene(QuadRenderData& data);
 
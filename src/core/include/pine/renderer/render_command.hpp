@@ -1,8 +1,11 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <utility>
 
+#include "pine/renderer/render_command_queue.hpp"
 #include "pine/renderer/renderer_api.hpp"
 #include "pine/utils/math.hpp"
 
@@ -11,30 +14,133 @@ namespace pine
 
 class RenderCommand
 {
+    /*
+    Entry point for render commands. While a render thread is running,
+    commands are recorded into its queue and executed one frame later, so
+    arguments passed by reference, e.g. vertex arrays, must outlive the frame.
+    Otherwise, commands execute immediately.
+    */
+
 public:
     inline static void init() { s_renderer_api->init(); }
 
     inline static void set_viewport(const uint32_t x, const uint32_t y,
         const uint32_t width, const uint32_t height)
     {
-        s_renderer_api->set_viewport(x, y, width, height);
+        enqueue([x, y, width, height]()
+            { s_renderer_api->set_viewport(x, y, width, height); });
     }
 
     inline static void set_clear_color(const Vec4& color)
     {
-        s_renderer_api->set_clear_color(color);
+        enqueue([color]() { s_renderer_api->set_clear_color(color); });
     }
 
-    inline static void clear() { s_renderer_api->clear(); }
+    inline static void clear()
+    {
+        enqueue([]() { s_renderer_api->clear(); });
+    }
 
     inline static void draw_indexed(const VertexArray& vertex_array,
         const uint32_t index_count = 0)
     {
-        s_renderer_api->draw_indexed(vertex_array, index_count);
+        enqueue([&vertex_array, index_count]()
+            { s_renderer_api->draw_indexed(vertex_array, index_count); });
+    }
+
+    inline static void draw_indexed_indirect(const VertexArray& vertex_array,
+        const IndirectBuffer& indirect_buffer, const uint32_t draw_count,
+        const uint32_t first_draw = 0,
+        const RendererPrimitives primitive = RendererPrimitives::Triangles)
+    {
+        enqueue(
+            [&vertex_array,
+                &indirect_buffer,
+                draw_count,
+                first_draw,
+                primitive]()
+            {
+                s_renderer_api->draw_indexed_indirect(vertex_array,
+                    indirect_buffer,
+                    draw_count,
+                    first_draw,
+                    primitive);
+            });
+    }
+
+    inline static void draw_arrays_indirect(const VertexArray& vertex_array,
+        const IndirectBuffer& indirect_buffer, const uint32_t draw_count,
+        const uint32_t first_draw = 0,
+        const RendererPrimitives primitive = RendererPrimitives::Triangles)
+    {
+        enqueue(
+            [&vertex_array,
+                &indirect_buffer,
+                draw_count,
+                first_draw,
+                primitive]()
+            {
+                s_renderer_api->draw_arrays_indirect(vertex_array,
+                    indirect_buffer,
+                    draw_count,
+                    first_draw,
+                    primitive);
+            });
+    }
+
+    inline static void dispatch_compute(const uint32_t group_count_x,
+        const uint32_t group_count_y = 1, const uint32_t group_count_z = 1)
+    {
+        enqueue(
+            [group_count_x, group_count_y, group_count_z]()
+            {
+                s_renderer_api->dispatch_compute(group_count_x,
+                    group_count_y,
+                    group_count_z);
+            });
+    }
+
+    // Records a command if a render thread is running, otherwise executes it.
+    template <typename Func>
+    static void enqueue(Func&& func)
+    {
+        if (is_recording())
+        {
+            s_command_queue->submit(std::forward<Func>(func));
+        }
+        else
+        {
+            func();
+        }
+    }
+
+    // Returns a pointer to the data that stays valid until enqueued commands
+    // have executed. The data is copied only if commands are recorded.
+    static const void* stage_data(const void* data, const size_t size)
+    {
+        if (!is_recording())
+        {
+            return data;
+        }
+        auto* copy = s_command_queue->allocate(size);
+        std::memcpy(copy, data, size);
+        return copy;
+    }
+
+    static bool is_recording()
+    {
+        return !RenderCommandQueue::is_executing() && s_command_queue;
+    }
+
+    // Set by the render thread to the queue that is being recorded.
+    static void set_command_queue(RenderCommandQueue* queue)
+    {
+        s_command_queue = queue;
     }
 
 private:
     static std::unique_ptr<RendererAPI> s_renderer_api;
+    static RenderCommandQueue* s_command_queue;
 };
 
 } // namespace pine
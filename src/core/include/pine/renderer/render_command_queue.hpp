@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "pine/core/chunked_arena.hpp"
+
+namespace pine
+{
+
+class RenderCommandQueue
+{
+    /*
+    Records type-erased render commands, so that they can be executed later,
+    e.g. on the render thread. Commands and their data are stored in an arena
+    that is kept between frames, so recording stops allocating once the queue
+    has grown to fit a frame.
+    */
+
+    using InvokeFn = void (*)(void* command, const bool execute);
+
+    struct Command
+    {
+        void* storage;
+        InvokeFn invoke;
+    };
+
+public:
+    RenderCommandQueue() = default;
+    ~RenderCommandQueue();
+
+    RenderCommandQueue(const RenderCommandQueue&) = delete;
+    RenderCommandQueue(RenderCommandQueue&&) = delete;
+
+    RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+    RenderCommandQueue& operator=(RenderCommandQueue&&) = delete;
+
+    template <typename Func>
+    void submit(Func&& func)
+    {
+        using CommandType = std::decay_t<Func>;
+        auto* storage = allocate(sizeof(CommandType), alignof(CommandType));
+        new (storage) CommandType(std::forward<Func>(func));
+
+        m_commands.push_back({storage,
+            [](void* command, const bool execute)
+            {
+                auto* typed_command = static_cast<CommandType*>(command);
+                if (execute)
+                {
+                    (*typed_command)();
+                }
+                typed_command->~CommandType();
+            }});
+    }
+
+    // Returns memory that stays valid until the queue has been executed or
+    // cleared, e.g. for copies of per-frame data.
+    void* allocate(const size_t size,
+        const size_t alignment = alignof(std::max_align_t))
+    {
+        return m_arena.allocate(size, alignment);
+    }
+
+    // Executes the commands in submission order and clears the queue.
+    void execute();
+    // Destroys the commands without executing them.
+    void clear();
+
+    size_t get_command_count() const { return m_commands.size(); }
+    bool empty() const { return m_commands.empty(); }
+
+    // True on a thread that is currently executing a queue.
+    static bool is_executing();
+
+private:
+    void reset();
+
+private:
+    static constexpr size_t s_chunk_size = 256 * 1024;
+
+    std::vector<Command> m_commands;
+    ChunkedArena m_arena{s_chunk_size};
+};
+
+} // namespace pine
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "pine/renderer/graphics_context.hpp"
+#include "pine/renderer/render_command_queue.hpp"
+
+namespace pine
+{
+
+class RenderThread
+{
+    /*
+    Dedicated thread that owns the graphics context and executes render
+    commands. The main thread records frame N + 1 into one queue while the
+    render thread executes and presents frame N from the other.
+    */
+
+public:
+    RenderThread(GraphicsContext& context);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread(RenderThread&&) = delete;
+
+    RenderThread& operator=(const RenderThread&) = delete;
+    RenderThread& operator=(RenderThread&&) = delete;
+
+    // Hands the context over to the render thread and starts recording.
+    void start();
+    // Executes the pending frame, joins the thread and makes the context
+    // current on the calling thread again.
+    void stop();
+
+    // Submits the recorded frame for execution and presentation. Blocks while
+    // the render thread is still busy with the previous frame.
+    void kick();
+    // Blocks until the render thread has executed all submitted frames.
+    void wait_idle();
+
+    bool is_running() const { return m_thread.joinable(); }
+
+private:
+    void run();
+
+private:
+    GraphicsContext& m_context;
+    std::thread m_thread;
+
+    std::array<RenderCommandQueue, 2> m_queues;
+    uint32_t m_record_index = 0;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_frame_pending = false;
+    bool m_stop = false;
+};
+
+} // namespace pine
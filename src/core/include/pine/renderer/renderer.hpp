@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "pine/core/common.hpp"
+#include "pine/renderer/buffer.hpp"
 #include "pine/renderer/camera.hpp"
 #include "pine/renderer/renderer_api.hpp"
 #include "pine/renderer/shader.hpp"
@@ -14,24 +15,56 @@ namespace pine
 
 class ShaderLibrary;
 
+// Camera block of the batch renderer shaders, in std140 layout.
+struct CameraUniforms
+{
+    Mat4 view_projection = Mat4(1.0f);
+    Vec2 viewport_size = Vec2(0.0f);
+    Vec2 padding = Vec2(0.0f);
+};
+
 class Renderer
 {
 public:
+    // Binding point of the camera uniform buffer, which is shared by the
+    // batch renderers.
+    static constexpr uint32_t camera_binding = 0;
+
     static void init();
+    static void shutdown();
     static void on_window_resize(const uint32_t width, const uint32_t height);
 
-    static void begin_scene(const OrthographicCamera& camera);
+    // Uploads the camera to the camera uniform buffer. The viewport size is
+    // used for sizes in pixels, like line widths, and defaults to the window
+    // size.
+    static void begin_scene(const OrthographicCamera& camera,
+        const Vec2& viewport_size = Vec2(0.0f));
+    static void begin_scene(const PerspectiveCamera& camera,
+        const Vec2& viewport_size = Vec2(0.0f));
     static void end_scene();
 
+    // View projection of the current scene, e.g. for culling.
+    static const Mat4& get_view_projection_matrix()
+    {
+        return s_scene_data->view_projection_matrix;
+    }
+
+    // Records the draw, so the shader and vertex array must outlive the frame.
     static void submit(const Shader& shader, const VertexArray& vertexArray,
         const Mat4& transform = Mat4(1.0f));
 
     inline static RendererAPI::API get_api() { return RendererAPI::get_api(); }
 
+private:
+    static void upload_camera(const Mat4& view_projection,
+        const Vec2& viewport_size);
+
 private:
     struct SceneData
     {
         Mat4 view_projection_matrix;
+        Vec2 window_size = Vec2(0.0f);
+        std::unique_ptr<UniformBuffer> camera_buffer;
     };
 
     static std::unique_ptr<SceneData> s_scene_data;
@@ -4,6 +4,7 @@
 
 #include "pine/core/common.hpp"
 #include "pine/renderer/buffer.hpp"
+#include "pine/renderer/common.hpp"
 #include "pine/utils/math.hpp"
 
 namespace pine
@@ -31,6 +32,22 @@ public:
 
     virtual void draw_indexed(const VertexArray& vertex_array,
         const uint32_t index_count = 0) = 0;
+    // Draws the commands of the indirect buffer from the first command on,
+    // in a single call.
+    virtual void draw_indexed_indirect(const VertexArray& vertex_array,
+        const IndirectBuffer& indirect_buffer, const uint32_t draw_count,
+        const uint32_t first_draw = 0,
+        const RendererPrimitives primitive = RendererPrimitives::Triangles) = 0;
+    // Draws non-indexed commands of the indirect buffer in a single call.
+    virtual void draw_arrays_indirect(const VertexArray& vertex_array,
+        const IndirectBuffer& indirect_buffer, const uint32_t draw_count,
+        const uint32_t first_draw = 0,
+        const RendererPrimitives primitive = RendererPrimitives::Triangles) = 0;
+    // Runs the compute shader that is bound. The results are visible to the
+    // commands that follow.
+    virtual void dispatch_compute(const uint32_t group_count_x,
+        const uint32_t group_count_y = 1,
+        const uint32_t group_count_z = 1) = 0;
 
     inline static API get_api() { return s_api; }
     static std::unique_ptr<RendererAPI> create();
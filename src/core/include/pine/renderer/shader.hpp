@@ -2,14 +2,19 @@
 
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "pine/utils/math.hpp"
 
 namespace pine
 {
 
+class FileWatcher;
+class JobSystem;
+
 // TODO: Implement ShaderPreprocessor
 // - Read from source
 // - Read from file
@@ -40,11 +45,29 @@ public:
     virtual void set_mat4(const std::string& name, const Mat4& value) const = 0;
 
     virtual const std::string& get_name() const = 0;
+    // Empty for shaders that were created from sources.
+    virtual const std::filesystem::path& get_filepath() const = 0;
+
+    // Reads and preprocesses the file again for a reload. May be called from
+    // any thread.
+    virtual void reload_source() = 0;
+    // Compiles the reloaded source without blocking, and replaces the program
+    // once it has linked. Must be called on the thread of the graphics
+    // context, until the reload is done. A failed reload keeps the current
+    // program.
+    virtual void update_reload() = 0;
+    virtual bool is_reloading() const = 0;
 
     static std::unique_ptr<Shader> create(
         const std::filesystem::path& filepath);
     static std::unique_ptr<Shader> create(const std::string& name,
         const std::string& vertex_source, const std::string& fragment_source);
+
+    // Compiles the shaders as a batch, see ShaderLibrary::load_shaders.
+    // Shaders that fail to load are null.
+    static std::vector<std::unique_ptr<Shader>> create(
+        const std::vector<std::filesystem::path>& filepaths,
+        JobSystem* job_system = nullptr);
 };
 
 class ShaderLibrary
@@ -52,6 +75,15 @@ class ShaderLibrary
     using ShaderMap = std::unordered_map<std::string, std::shared_ptr<Shader>>;
 
 public:
+    ShaderLibrary();
+    ~ShaderLibrary();
+
+    ShaderLibrary(const ShaderLibrary&) = delete;
+    ShaderLibrary(ShaderLibrary&&) = delete;
+
+    ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+    ShaderLibrary& operator=(ShaderLibrary&&) = delete;
+
     void add_shader(const std::string& name,
         const std::shared_ptr<Shader>& shader);
     void add_shader(const std::shared_ptr<Shader>& shader);
@@ -59,13 +91,40 @@ public:
     bool load_shader(const std::string& name, const std::string filepath);
     bool load_shader(const std::string& filepath);
 
+    // Loads the shaders as a batch, which is faster than loading them one by
+    // one. Compiles and links are issued together, and drivers with parallel
+    // shader compilation run them concurrently. Files are read and
+    // preprocessed on the job system, if one is given. Returns false if any
+    // of the shaders failed to load, the others are added regardless.
+    bool load_shaders(const std::vector<std::string>& filepaths,
+        JobSystem* job_system = nullptr);
+
     const std::shared_ptr<Shader>& get_shader(const std::string& name) const;
     const ShaderMap& get_shader_map() const { return m_shaders; }
 
     bool has_shader(const std::string& name) const;
 
+    // Watches the files of the shaders, and reloads the shaders when they
+    // change. The files are read and preprocessed on the watcher thread.
+    void set_hot_reload(const bool enabled);
+    bool is_hot_reload_enabled() const { return m_watcher != nullptr; }
+
+    // Swaps in the reloaded programs. Call once per frame, the programs are
+    // compiled through render commands.
+    void update_hot_reload();
+
+private:
+    void watch_shader(const std::shared_ptr<Shader>& shader);
+
 private:
     ShaderMap m_shaders;
+
+    std::mutex m_reload_mutex;
+    std::vector<std::shared_ptr<Shader>> m_reloading;
+
+    // Declared last, so that its thread stops before the members that the
+    // callbacks use are destroyed.
+    std::unique_ptr<FileWatcher> m_watcher;
 };
 
 } // namespace pine
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string_view>
+
+#include "pine/renderer/buffer.hpp"
+#include "pine/renderer/font.hpp"
+#include "pine/renderer/shader.hpp"
+#include "pine/renderer/texture.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+struct TextVertex
+{
+    Vec3 position = {};
+    Vec4 color = {};
+    Vec2 texture_coordinates = {};
+};
+
+struct TextRenderCaps
+{
+    static constexpr uint32_t max_glyphs = 20000;
+    static constexpr uint32_t vertices_per_glyph = 4;
+    static constexpr uint32_t indices_per_glyph = 6;
+    static constexpr uint32_t max_vertices = max_glyphs * vertices_per_glyph;
+    static constexpr uint32_t max_indices = max_glyphs * indices_per_glyph;
+};
+
+struct TextRenderStatistics
+{
+    uint32_t draw_calls = 0;
+    uint32_t glyph_count = 0;
+
+    uint32_t get_total_vertex_count()
+    {
+        return glyph_count * TextRenderCaps::vertices_per_glyph;
+    }
+
+    uint32_t get_total_index_count()
+    {
+        return glyph_count * TextRenderCaps::indices_per_glyph;
+    }
+};
+
+struct TextRenderData
+{
+    std::shared_ptr<Shader> text_shader = {};
+    std::unique_ptr<VertexArray> text_vertex_array = {};
+
+    // Atlas of the current batch, a different font starts a new batch.
+    std::shared_ptr<Texture2D> font_atlas = {};
+    std::array<TextVertex, TextRenderCaps::max_vertices> text_vertices{};
+
+    uint32_t text_vertex_count = 0;
+    uint32_t text_index_count = 0;
+
+    TextRenderStatistics statistics{};
+}; // TextRenderData
+
+namespace TextRenderer
+{
+// Loads the text shader unless one is given, e.g. from a shader library.
+TextRenderData init(const std::shared_ptr<Shader>& text_shader = nullptr);
+void shutdown(TextRenderData& data);
+
+// Uses the camera of Renderer::begin_scene.
+void begin_scene(TextRenderData& data);
+void end_scene(TextRenderData& data);
+
+void flush(TextRenderData& data);
+void flush_and_reset(TextRenderData& data);
+
+// The position is the top left corner of the text, and the size is the line
+// height. Newlines start a new line.
+void draw_text(TextRenderData& data, const Font& font,
+    const std::string_view text, const Vec2& position, const float size,
+    const Vec4& color);
+void draw_text(TextRenderData& data, const Font& font,
+    const std::string_view text, const Vec3& position, const float size,
+    const Vec4& color);
+// The transform maps from units of the line height, with the origin at the
+// top left corner of the text.
+void draw_text(TextRenderData& data, const Font& font,
+    const std::string_view text, const Mat4& transform, const Vec4& color);
+} // namespace TextRenderer
+
+} // namespace pine
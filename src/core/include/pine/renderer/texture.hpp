@@ -10,6 +10,12 @@
 namespace pine
 {
 
+enum class TextureFilter : uint8_t
+{
+    NEAREST, // Keeps texels sharp, e.g. for pixel art.
+    LINEAR // Needed for distance fields, e.g. font atlases.
+};
+
 class Texture
 {
 public:
@@ -29,9 +35,42 @@ public:
 class Texture2D : public Texture
 {
 public:
+    virtual ~Texture2D();
+
+    // Replaces the contents of the texture, which may change its size and
+    // format.
+    virtual void set_image(const Image& image) = 0;
+
     static std::unique_ptr<Texture2D> create(
         const std::filesystem::path& filepath);
-    static std::unique_ptr<Texture2D> create(const Image& image);
+    // The filter applies to magnification, minification is linear.
+    static std::unique_ptr<Texture2D> create(const Image& image,
+        const TextureFilter filter = TextureFilter::NEAREST);
+
+    // Watches the files of the textures that were created from files, and
+    // reloads the textures when they change. The images are decoded on the
+    // watcher thread.
+    static void set_hot_reload(const bool enabled);
+    // Uploads the reloaded images. Call once per frame, the uploads are
+    // render commands.
+    static void update_hot_reload();
+};
+
+class IndexTexture2D : public Texture
+{
+    /*
+    Texture of unsigned 16-bit integers that are fetched without filtering,
+    e.g. tile indices. Shaders sample it with an unsigned integer sampler.
+    */
+
+public:
+    virtual ~IndexTexture2D() = default;
+
+    // Replaces the indices of the whole texture, row by row.
+    virtual void set_data(const uint16_t* indices) = 0;
+
+    static std::unique_ptr<IndexTexture2D> create(const uint32_t width,
+        const uint32_t height);
 };
 
 } // namespace pine
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+#include "pine/renderer/image.hpp"
+
+namespace pine
+{
+
+enum class TextureCompression : uint8_t
+{
+    NONE = 0,
+    BC1 = 1,
+    BC3 = 2
+};
+
+struct TextureCacheHeader
+{
+    static constexpr std::array<char, 4> file_magic = {'P', 'T', 'E', 'X'};
+    static constexpr uint32_t file_version = 1;
+
+    std::array<char, 4> magic = file_magic;
+    uint32_t version = file_version;
+    uint64_t content_hash = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t mip_count = 0;
+    TextureFormat format = TextureFormat::UNKNOWN;
+    TextureCompression compression = TextureCompression::NONE;
+    uint16_t reserved = 0;
+};
+
+struct TextureCacheMip
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint64_t offset = 0; // Byte offset from the start of the file.
+    uint64_t size = 0;
+};
+
+class MappedTextureFile
+{
+    /*
+    Read-only memory mapping of a pine texture cache file. The header and mip
+    table are validated on open, the texel data is never copied.
+    */
+
+public:
+    MappedTextureFile() = default;
+    ~MappedTextureFile();
+
+    MappedTextureFile(const MappedTextureFile&) = delete;
+    MappedTextureFile(MappedTextureFile&& other) noexcept;
+
+    MappedTextureFile& operator=(const MappedTextureFile&) = delete;
+    MappedTextureFile& operator=(MappedTextureFile&& other) noexcept;
+
+    static std::optional<MappedTextureFile> open(
+        const std::filesystem::path& filepath);
+
+    const TextureCacheHeader& get_header() const;
+    const TextureCacheMip& get_mip(const uint32_t level) const;
+    const uint8_t* get_mip_data(const uint32_t level) const;
+
+    // Total number of texel bytes, i.e. the file without header and table.
+    uint64_t get_data_size() const;
+    const uint8_t* get_data() const;
+
+private:
+    const uint8_t* m_data = nullptr;
+    uint64_t m_size = 0;
+};
+
+// Content hash (FNV-1a) of a file, used as texture cache key.
+uint64_t hash_file_contents(const std::filesystem::path& filepath);
+
+void set_texture_cache_directory(const std::filesystem::path& directory);
+const std::filesystem::path& get_texture_cache_directory();
+
+std::filesystem::path get_texture_cache_path(const uint64_t content_hash);
+
+// Returns the mapped cache entry of a source image, if one exists.
+std::optional<MappedTextureFile> find_cached_texture(
+    const std::filesystem::path& source_path);
+
+bool write_texture_cache(const std::filesystem::path& filepath,
+    const Image& image, const uint64_t content_hash,
+    const bool generate_mips = true);
+
+} // namespace pine
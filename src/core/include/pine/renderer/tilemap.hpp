@@ -0,0 +1,88 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "pine/renderer/texture.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+struct TilemapChunk
+{
+    std::vector<uint16_t> tiles = {};
+    std::shared_ptr<IndexTexture2D> texture = {};
+
+    // Set when the tiles have changed since they were uploaded.
+    bool dirty = true;
+};
+
+class Tilemap
+{
+    /*
+    Grid of tiles that is split into square chunks. Each chunk keeps its tile
+    indices in an integer texture and is drawn as a single quad, which looks
+    up the tiles in the fragment shader. The tiles are stored row by row from
+    the bottom left corner of the map.
+    */
+
+public:
+    // Number of tiles along each side of a chunk.
+    static constexpr uint32_t chunk_size = 128;
+    // Tile index of tiles that are not drawn. Tile index n draws cell n - 1
+    // of the tileset, counted row by row from its bottom left cell.
+    static constexpr uint16_t empty_tile = 0;
+
+    // The position is the bottom left corner of the map, and the tile size is
+    // in world units.
+    Tilemap(const uint32_t width, const uint32_t height,
+        const std::shared_ptr<Texture2D>& tileset,
+        const uint32_t tileset_columns, const uint32_t tileset_rows,
+        const Vec3& position = Vec3(0.0f), const Vec2& tile_size = Vec2(1.0f));
+
+    Tilemap(const Tilemap&) = delete;
+    Tilemap(Tilemap&&) = delete;
+
+    Tilemap& operator=(const Tilemap&) = delete;
+    Tilemap& operator=(Tilemap&&) = delete;
+
+    void set_tile(const uint32_t x, const uint32_t y, const uint16_t tile);
+    uint16_t get_tile(const uint32_t x, const uint32_t y) const;
+
+    uint32_t get_width() const { return m_width; }
+    uint32_t get_height() const { return m_height; }
+
+    uint32_t get_chunk_columns() const { return m_chunk_columns; }
+    uint32_t get_chunk_rows() const { return m_chunk_rows; }
+
+    // Chunks are stored row by row.
+    std::vector<TilemapChunk>& get_chunks() { return m_chunks; }
+    const std::vector<TilemapChunk>& get_chunks() const { return m_chunks; }
+
+    // Maps the unit square to the area of the chunk in world space.
+    Mat4 get_chunk_transform(const uint32_t column, const uint32_t row) const;
+
+    const std::shared_ptr<Texture2D>& get_tileset() const { return m_tileset; }
+    uint32_t get_tileset_columns() const { return m_tileset_columns; }
+    uint32_t get_tileset_rows() const { return m_tileset_rows; }
+
+    const Vec3& get_position() const { return m_position; }
+    const Vec2& get_tile_size() const { return m_tile_size; }
+
+private:
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_chunk_columns;
+    uint32_t m_chunk_rows;
+    std::vector<TilemapChunk> m_chunks;
+
+    std::shared_ptr<Texture2D> m_tileset;
+    uint32_t m_tileset_columns;
+    uint32_t m_tileset_rows;
+
+    Vec3 m_position;
+    Vec2 m_tile_size;
+};
+
+} // namespace pine
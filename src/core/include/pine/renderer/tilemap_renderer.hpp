@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "pine/renderer/buffer.hpp"
+#include "pine/renderer/shader.hpp"
+#include "pine/renderer/texture.hpp"
+#include "pine/renderer/tilemap.hpp"
+#include "pine/utils/math.hpp"
+
+namespace pine
+{
+
+struct TilemapVertex
+{
+    Vec3 position = {};
+    Vec2 texture_coordinates = {};
+};
+
+struct TilemapChunkDraw
+{
+    Mat4 transform = Mat4(1.0f);
+    std::shared_ptr<IndexTexture2D> tiles = {};
+    std::shared_ptr<Texture2D> tileset = {};
+    uint32_t tileset_columns = 1;
+    uint32_t tileset_rows = 1;
+};
+
+struct TilemapRenderStatistics
+{
+    uint32_t draw_calls = 0;
+    uint32_t chunk_count = 0;
+    uint32_t culled_chunk_count = 0;
+    uint32_t uploaded_chunk_count = 0;
+};
+
+struct TilemapRenderData
+{
+    std::shared_ptr<Shader> tilemap_shader = {};
+    // Unit quad that every chunk is drawn with.
+    std::unique_ptr<VertexArray> chunk_vertex_array = {};
+
+    std::vector<TilemapChunkDraw> chunk_draws = {};
+
+    TilemapRenderStatistics statistics{};
+}; // TilemapRenderData
+
+namespace TilemapRenderer
+{
+// Loads the tilemap shader unless one is given, e.g. from a shader library.
+TilemapRenderData init(const std::shared_ptr<Shader>& tilemap_shader = nullptr);
+void shutdown(TilemapRenderData& data);
+
+// Uses the camera of Renderer::begin_scene.
+void begin_scene(TilemapRenderData& data);
+void end_scene(TilemapRenderData& data);
+
+void flush(TilemapRenderData& data);
+
+// Culls the chunks against the camera of the scene, and uploads the tiles of
+// visible chunks that have changed. Each visible chunk is one draw call.
+void draw_tilemap(TilemapRenderData& data, Tilemap& tilemap);
+} // namespace TilemapRenderer
+
+} // namespace pine
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace pine
+{
+
+class FileWatcher
+{
+    /*
+    Watches files for changes on a background thread. Uses inotify on Linux,
+    and polls the modification times on other platforms. Directories are
+    watched rather than the files, so that files which are replaced by
+    editors on save are still picked up.
+    */
+
+public:
+    using WatchID = uint32_t;
+    using Callback = std::function<void(const std::filesystem::path&)>;
+
+    FileWatcher();
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher(FileWatcher&&) = delete;
+
+    FileWatcher& operator=(const FileWatcher&) = delete;
+    FileWatcher& operator=(FileWatcher&&) = delete;
+
+    // The callback is called from the watcher thread, once per batch of
+    // changes to the file.
+    WatchID watch(const std::filesystem::path& filepath, Callback callback);
+    void unwatch(const WatchID id);
+
+private:
+    struct Watch
+    {
+        std::filesystem::path filepath;
+        Callback callback;
+        std::filesystem::file_time_type write_time;
+    };
+
+    void run();
+    void notify(const std::filesystem::path& filepath);
+
+    void add_directory(const std::filesystem::path& directory);
+
+private:
+    std::mutex m_mutex;
+    std::unordered_map<WatchID, Watch> m_watches;
+    WatchID m_next_id = 1;
+
+    // inotify instance and watch descriptors of the directories, if available.
+    int m_notify_fd = -1;
+    std::unordered_map<int, std::filesystem::path> m_directories;
+
+    std::atomic<bool> m_stop = false;
+    std::thread m_thread;
+
+    static constexpr std::chrono::milliseconds s_poll_interval{100};
+};
+
+} // namespace pine
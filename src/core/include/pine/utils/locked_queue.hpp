@@ -2,6 +2,9 @@
 
 #include <deque>
 #include <mutex>
+#include <optional>
+
+#include "pine/debug/memory_tracker.hpp"
 
 namespace pine
 {
@@ -9,6 +12,8 @@ namespace pine
 template <typename T>
 class LockedQueue
 {
+    using DequeType = std::deque<T, TrackingAllocator<T, MemoryTag::QUEUE>>;
+
 public:
     LockedQueue() = default;
 
@@ -38,12 +43,24 @@ public:
         m_deque.push_front(t);
     }
 
+    void push_front(T&& t)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_deque.push_front(std::move(t));
+    }
+
     void push_back(const T& t)
     {
         std::scoped_lock lock(m_mutex);
         m_deque.push_back(t);
     }
 
+    void push_back(T&& t)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_deque.push_back(std::move(t));
+    }
+
     bool empty()
     {
         std::scoped_lock lock(m_mutex);
@@ -53,7 +70,7 @@ public:
     uint64_t count()
     {
         std::scoped_lock lock(m_mutex);
-        return m_deque.count();
+        return m_deque.size();
     }
 
     void clear()
@@ -70,6 +87,20 @@ public:
         return t;
     }
 
+    // Checks for and pops an element under a single lock, for use with
+    // multiple consumers.
+    std::optional<T> try_pop_front()
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_deque.empty())
+        {
+            return std::nullopt;
+        }
+        auto t = std::move(m_deque.front());
+        m_deque.pop_front();
+        return t;
+    }
+
     T pop_back()
     {
         std::scoped_lock lock(m_mutex);
@@ -78,25 +109,25 @@ public:
         return t;
     }
 
-    typename std::deque<T>::iterator begin()
+    typename DequeType::iterator begin()
     {
         std::scoped_lock lock(m_mutex);
         return m_deque.begin();
     }
 
-    typename std::deque<T>::iterator end()
+    typename DequeType::iterator end()
     {
         std::scoped_lock lock(m_mutex);
         return m_deque.end();
     }
 
-    typename std::deque<T>::const_iterator begin() const
+    typename DequeType::const_iterator begin() const
     {
         std::scoped_lock lock(m_mutex);
         return m_deque.cbegin();
     }
 
-    typename std::deque<T>::const_iterator end() const
+    typename DequeType::const_iterator end() const
     {
         std::scoped_lock lock(m_mutex);
         return m_deque.cend();
@@ -104,7 +135,7 @@ public:
 
 protected:
     std::mutex m_mutex;
-    std::deque<T> m_deque;
+    DequeType m_deque;
 };
 
 } // namespace pine
@@ -50,6 +50,12 @@ Mat4 ortho(Args... args)
     return glm::ortho(args...);
 }
 
+template <typename... Args>
+Mat4 perspective(Args... args)
+{
+    return glm::perspective(args...);
+}
+
 template <typename... Args>
 Mat4 inverse(Args... args)
 {
@@ -1,11 +1,16 @@
 #include "pine/core/application.hpp"
 
-#include <GLFW/glfw3.h>
+#include <cmath>
 
+#include "pine/core/frame_allocator.hpp"
 #include "pine/core/input.hpp"
 #include "pine/core/log.hpp"
 #include "pine/core/timestep.hpp"
+#include "pine/debug/gpu_instrumentor.hpp"
+#include "pine/debug/memory_tracker.hpp"
+#include "pine/debug/metrics.hpp"
 #include "pine/pch.hpp"
+#include "pine/renderer/render_command.hpp"
 #include "pine/renderer/renderer.hpp"
 
 namespace pine
@@ -18,6 +23,8 @@ Application::Application(const ApplicationSpecs& specs) : specification(specs)
     PINE_CORE_ASSERT(!instance, "Application already exists!");
     instance = this;
 
+    job_system = std::make_unique<JobSystem>(specification.worker_count);
+
     WindowSpecs window_specs;
     window_specs.title = specification.name;
     window_specs.width = specification.window_width;
@@ -27,7 +34,14 @@ Application::Application(const ApplicationSpecs& specs) : specification(specs)
 
     window = Window::create(window_specs);
     window->init();
-    window->set_event_callback(PINE_BIND_EVENT_FN(Application::on_event));
+
+    auto& event_queue = window->get_event_queue();
+    event_queue.set_handler<WindowCloseEvent>(
+        PINE_BIND_EVENT_FN(Application::on_window_close));
+    event_queue.set_handler<WindowResizeEvent>(
+        PINE_BIND_EVENT_FN(Application::on_window_resize));
+    event_queue.set_handler<WindowIconifyEvent>(
+        PINE_BIND_EVENT_FN(Application::on_window_iconify));
 
     if (specification.start_maximized)
     {
@@ -41,31 +55,80 @@ Application::Application(const ApplicationSpecs& specs) : specification(specs)
     window->set_resizable(specification.resizable);
     window->set_vsync(specification.vsync);
 
+    frame_limiter.set_target_fps(specification.target_fps);
+
     Renderer::init();
 
-    gui = GraphicalInterface::create(window.get());
+    gui = GraphicalInterface::create(window.get(),
+        !specification.threaded_rendering);
+
+    if (specification.threaded_rendering)
+    {
+        render_thread = std::make_unique<RenderThread>(window->get_context());
+    }
 }
 
 Application::~Application()
 {
-    window->set_event_callback([]([[maybe_unused]] Event& event) {});
+    render_thread.reset();
+    Renderer::shutdown();
+    GPUInstrumentor::Shutdown();
 }
 
 void Application::run()
 {
     on_init();
+    if (render_thread)
+    {
+        // Create the GPU instrumentor while this thread owns the context.
+        GPUInstrumentor::Get();
+        render_thread->start();
+    }
+
+    last_frame_time = std::chrono::steady_clock::now();
     while (running)
     {
-        // TODO: Temporary.
-        auto time = static_cast<float>(glfwGetTime()); // Platform::GetTime
-        Timestep ts = time - last_frame_time;
+        // Memory from the frame allocators is only valid within a frame.
+        FrameAllocator::begin_frame();
+
+        // Block instead of spinning while there is nothing to draw.
+        if (minimized || is_idle())
+        {
+            window->wait_events(specification.idle_timeout);
+        }
+        else
+        {
+            window->poll_events();
+        }
+
+        // Events are recorded while polling and dispatched here in one batch.
+        auto& event_queue = window->get_event_queue();
+        if (!event_queue.empty())
+        {
+            // The GUI needs a second frame to settle, e.g. for hover states.
+            redraw_frames = 2;
+            event_queue.dispatch(PINE_BIND_EVENT_FN(Application::on_event));
+        }
 
-        window->poll_events();
+        // Time is kept as a steady clock time point, so the frame time stays
+        // precise regardless of the uptime.
+        const auto time = std::chrono::steady_clock::now();
+        const auto frame_time =
+            std::chrono::duration<double>(time - last_frame_time).count();
+        last_frame_time = time;
 
-        // Update layers.
-        if (!minimized)
+        // Update layers, unless the wait timed out without a redraw.
+        if (!minimized && !is_idle())
         {
-            last_frame_time = time;
+            const auto frame_start = std::chrono::steady_clock::now();
+            RenderCommand::enqueue(
+                []() { GPUInstrumentor::Get().BeginFrame(); });
+
+            const auto alpha = specification.loop_mode == LoopMode::FIXED
+                ? run_fixed_updates(frame_time)
+                : 1.0f;
+
+            const Timestep ts(static_cast<float>(frame_time), alpha);
             for (Layer* layer : layer_stack)
             {
                 layer->on_update(ts);
@@ -76,38 +139,90 @@ void Application::run()
                 render_gui();
             }
 
-            window->swap_buffers();
+            RenderCommand::enqueue([]() { GPUInstrumentor::Get().EndFrame(); });
+
+            // CPU time excludes the swap, which may block on vsync.
+            const auto cpu_time = std::chrono::duration<float, std::milli>(
+                std::chrono::steady_clock::now() - frame_start);
+            Metrics::count(FrameMetric::FRAME_ALLOCATIONS,
+                FrameAllocator::get().get_statistics().allocation_count);
+            Metrics::end_frame(cpu_time.count(),
+                GPUInstrumentor::Get().GetFrameTime(),
+                ts.get_milliseconds());
+            if constexpr (MemoryTracker::is_enabled())
+            {
+                MemoryTracker::update();
+            }
+
+            if (render_thread)
+            {
+                render_thread->kick();
+            }
+            else
+            {
+                window->swap_buffers();
+            }
+            frame_limiter.wait();
+
+            auto frames = redraw_frames.load();
+            while (frames > 0
+                && !redraw_frames.compare_exchange_weak(frames, frames - 1))
+            {
+            }
         }
     }
+    if (render_thread)
+    {
+        render_thread->stop();
+    }
     on_shutdown();
 }
 
+float Application::run_fixed_updates(const double frame_time)
+{
+    PINE_PROFILE_FUNCTION();
+    const auto tick = 1.0 / specification.tick_rate;
+    const Timestep ts(static_cast<float>(tick));
+
+    tick_accumulator += frame_time;
+    uint32_t steps = 0;
+    while (tick_accumulator >= tick && steps < specification.max_catch_up_steps)
+    {
+        for (Layer* layer : layer_stack)
+        {
+            layer->on_fixed_update(ts);
+        }
+        tick_accumulator -= tick;
+        steps++;
+    }
+
+    // Drop the time that could not be caught up on, so that a slow frame
+    // does not cause ever longer frames.
+    if (tick_accumulator >= tick)
+    {
+        tick_accumulator = std::fmod(tick_accumulator, tick);
+    }
+
+    return static_cast<float>(tick_accumulator / tick);
+}
+
 void Application::close() { running = false; }
 
-void Application::on_event(Event& event)
+bool Application::is_idle() const
 {
-    EventDispatcher dispatcher(event);
-    dispatcher.dispatch<WindowCloseEvent>(
-        [this](WindowCloseEvent& event) -> bool
-        {
-            return on_window_close(event);
-        });
-    dispatcher.dispatch<WindowResizeEvent>(
-        [this](WindowResizeEvent& event) -> bool
-        {
-            return on_window_resize(event);
-        });
-    dispatcher.dispatch<WindowIconifyEvent>(
-        [this](WindowIconifyEvent& event) -> bool
-        {
-            return on_window_iconify(event);
-        });
+    return specification.render_on_demand && redraw_frames == 0;
+}
 
-    //PINE_BIND_EVENT_FN(Application::on_window_close));
-    //PINE_BIND_EVENT_FN(Application::on_window_resize));
-    //PINE_BIND_EVENT_FN(Application::on_window_iconify));
+void Application::request_redraw()
+{
+    redraw_frames = std::max(redraw_frames.load(), 1u);
+    window->post_empty_event();
+}
 
-    // Handle event in the GUI first.
+void Application::on_event(Event& event)
+{
+    // Window events have already been passed to the handlers of the event
+    // queue. Handle event in the GUI first.
     gui->on_event(event);
 
     for (auto it = layer_stack.end(); it != layer_stack.begin();)
@@ -0,0 +1,52 @@
+#include "pine/core/chunked_arena.hpp"
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+ChunkedArena::ChunkedArena(const size_t chunk_size) : m_chunk_size(chunk_size)
+{
+}
+
+void* ChunkedArena::allocate(const size_t size, const size_t alignment)
+{
+    while (m_chunk_index < m_chunks.size())
+    {
+        auto& chunk = m_chunks[m_chunk_index];
+        // Align the address rather than the offset, to support alignments
+        // beyond the one of the chunk.
+        const auto base = reinterpret_cast<uintptr_t>(chunk.data.get());
+        const auto address =
+            (base + m_chunk_offset + alignment - 1) & ~(alignment - 1);
+        const auto offset = address - base;
+        if (offset + size <= chunk.size)
+        {
+            m_chunk_offset = offset + size;
+            return chunk.data.get() + offset;
+        }
+        m_chunk_index++;
+        m_chunk_offset = 0;
+    }
+
+    // The chunk is kept after a reset, so this only happens while the arena
+    // grows to fit its largest use.
+    const auto chunk_size = std::max(size + alignment, m_chunk_size);
+    m_chunks.push_back({std::make_unique<std::byte[]>(chunk_size), chunk_size});
+    m_chunk_index = m_chunks.size() - 1;
+    m_capacity += chunk_size;
+
+    auto& chunk = m_chunks.back();
+    const auto base = reinterpret_cast<uintptr_t>(chunk.data.get());
+    const auto address = (base + alignment - 1) & ~(alignment - 1);
+    m_chunk_offset = address - base + size;
+    return chunk.data.get() + (address - base);
+}
+
+void ChunkedArena::reset()
+{
+    m_chunk_index = 0;
+    m_chunk_offset = 0;
+}
+
+} // namespace pine
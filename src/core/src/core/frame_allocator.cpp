@@ -0,0 +1,79 @@
+#include "pine/core/frame_allocator.hpp"
+
+#include "pine/debug/metrics.hpp"
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+static std::atomic<uint64_t> s_frame_index = 0;
+
+FrameAllocator::FrameAllocator(const size_t chunk_size)
+    : m_arena(chunk_size), m_frame_index(s_frame_index.load())
+{
+}
+
+void FrameAllocator::reset()
+{
+    m_arena.reset();
+    m_statistics.allocation_count = 0;
+    m_statistics.allocated_bytes = 0;
+}
+
+FrameAllocator& FrameAllocator::get()
+{
+    static thread_local FrameAllocator allocator;
+    return allocator;
+}
+
+void FrameAllocator::begin_frame()
+{
+    auto& allocator = get();
+    allocator.m_frame_index =
+        s_frame_index.fetch_add(1, std::memory_order_relaxed) + 1;
+    allocator.reset();
+}
+
+uint64_t FrameAllocator::get_frame_index()
+{
+    return s_frame_index.load(std::memory_order_relaxed);
+}
+
+void* FrameAllocator::do_allocate(const size_t bytes, const size_t alignment)
+{
+    const auto frame_index = s_frame_index.load(std::memory_order_relaxed);
+    if (frame_index != m_frame_index)
+    {
+        m_frame_index = frame_index;
+        reset();
+    }
+
+    m_statistics.allocation_count++;
+    m_statistics.allocated_bytes += bytes;
+
+    const auto chunk_count = m_arena.get_chunk_count();
+    auto* pointer = m_arena.allocate(bytes, alignment);
+    if (m_arena.get_chunk_count() != chunk_count)
+    {
+        // The chunk is kept for later frames, so this only happens while the
+        // allocator grows to fit a frame.
+        m_statistics.heap_allocation_count++;
+        m_statistics.capacity = m_arena.get_capacity();
+        Metrics::count(FrameMetric::FRAME_HEAP_ALLOCATIONS, 1);
+    }
+    return pointer;
+}
+
+void FrameAllocator::do_deallocate([[maybe_unused]] void* pointer,
+    [[maybe_unused]] const size_t bytes,
+    [[maybe_unused]] const size_t alignment)
+{
+}
+
+bool FrameAllocator::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+} // namespace pine
@@ -0,0 +1,83 @@
+#include "pine/core/frame_limiter.hpp"
+
+#include <cmath>
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+FrameLimiter::FrameLimiter(const double target_fps)
+{
+    set_target_fps(target_fps);
+}
+
+void FrameLimiter::set_target_fps(const double target_fps)
+{
+    m_target_fps = target_fps > 0.0 ? target_fps : 0.0;
+    m_period = m_target_fps > 0.0
+        ? std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / m_target_fps))
+        : Clock::duration::zero();
+    m_next_frame = Clock::time_point{};
+}
+
+void FrameLimiter::wait()
+{
+    PINE_PROFILE_FUNCTION();
+    if (m_period == Clock::duration::zero())
+    {
+        return;
+    }
+
+    auto now = Clock::now();
+    if (now >= m_next_frame)
+    {
+        // Restart the schedule if more than a frame behind, instead of
+        // rushing through frames to catch up.
+        m_next_frame = now - m_next_frame > m_period ? now + m_period
+                                                     : m_next_frame + m_period;
+        return;
+    }
+
+    static constexpr auto sleep_step = std::chrono::milliseconds(1);
+    while (std::chrono::duration<double>(m_next_frame - now).count()
+        > m_sleep_estimate)
+    {
+        const auto sleep_start = Clock::now();
+        std::this_thread::sleep_for(sleep_step);
+        now = Clock::now();
+        update_sleep_estimate(
+            std::chrono::duration<double>(now - sleep_start).count());
+    }
+
+    while (Clock::now() < m_next_frame)
+    {
+        std::this_thread::yield();
+    }
+
+    m_next_frame += m_period;
+}
+
+void FrameLimiter::update_sleep_estimate(const double duration)
+{
+    // Welford's algorithm. The count is capped so that the estimate keeps
+    // adapting if the scheduler behaviour changes.
+    static constexpr uint64_t max_count = 1000;
+    m_sleep_count = std::min(m_sleep_count + 1, max_count);
+
+    const auto delta = duration - m_sleep_mean;
+    m_sleep_mean += delta / static_cast<double>(m_sleep_count);
+    m_sleep_m2 += delta * (duration - m_sleep_mean);
+    if (m_sleep_count == max_count)
+    {
+        m_sleep_m2 *= static_cast<double>(max_count - 1)
+            / static_cast<double>(max_count);
+    }
+
+    const auto sample_count = std::max<uint64_t>(m_sleep_count - 1, 1);
+    const auto variance = m_sleep_m2 / static_cast<double>(sample_count);
+    m_sleep_estimate = m_sleep_mean + std::sqrt(variance);
+}
+
+} // namespace pine
@@ -0,0 +1,333 @@
+#include "pine/core/job_system.hpp"
+
+#include "pine/core/assert.hpp"
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+// Identifies the deque of the calling thread, if it belongs to a job system.
+static thread_local const JobSystem* s_thread_owner = nullptr;
+static thread_local uint32_t s_thread_index = 0;
+
+WorkStealingDeque::WorkStealingDeque(const int64_t capacity)
+{
+    PINE_CORE_ASSERT((capacity & (capacity - 1)) == 0,
+        "Deque capacity must be a power of two.");
+    m_arrays.push_back(std::make_unique<Array>(capacity));
+    m_array.store(m_arrays.back().get(), std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::push(Job* job)
+{
+    const auto bottom = m_bottom.load(std::memory_order_relaxed);
+    const auto top = m_top.load(std::memory_order_acquire);
+    auto* array = m_array.load(std::memory_order_relaxed);
+    if (bottom - top > array->capacity - 1)
+    {
+        array = grow(array, bottom, top);
+    }
+    array->put(bottom, job);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+Job* WorkStealingDeque::pop()
+{
+    const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    auto* array = m_array.load(std::memory_order_relaxed);
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    auto* job = array->get(bottom);
+    if (top == bottom)
+    {
+        // Last job, race against thieves.
+        if (!m_top.compare_exchange_strong(top,
+                top + 1,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed))
+        {
+            job = nullptr;
+        }
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job* WorkStealingDeque::steal()
+{
+    auto top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto bottom = m_bottom.load(std::memory_order_acquire);
+    if (top >= bottom)
+    {
+        return nullptr;
+    }
+
+    auto* array = m_array.load(std::memory_order_acquire);
+    auto* job = array->get(top);
+    if (!m_top.compare_exchange_strong(top,
+            top + 1,
+            std::memory_order_seq_cst,
+            std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+    return job;
+}
+
+bool WorkStealingDeque::empty() const
+{
+    return m_bottom.load(std::memory_order_relaxed)
+        <= m_top.load(std::memory_order_relaxed);
+}
+
+WorkStealingDeque::Array* WorkStealingDeque::grow(Array* array,
+    const int64_t bottom, const int64_t top)
+{
+    m_arrays.push_back(std::make_unique<Array>(array->capacity * 2));
+    auto* grown = m_arrays.back().get();
+    for (auto index = top; index < bottom; index++)
+    {
+        grown->put(index, array->get(index));
+    }
+    m_array.store(grown, std::memory_order_release);
+    return grown;
+}
+
+JobSystem::JobSystem(const uint32_t worker_count)
+{
+    const auto core_count = std::max(std::thread::hardware_concurrency(), 2u);
+    const auto count = worker_count ? worker_count : core_count - 1;
+
+    for (uint32_t index = 0; index <= count; index++)
+    {
+        m_deques.push_back(std::make_unique<WorkStealingDeque>());
+    }
+
+    s_thread_owner = this;
+    s_thread_index = count;
+
+    for (uint32_t index = 0; index < count; index++)
+    {
+        m_workers.emplace_back([this, index]() { worker_loop(index); });
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::scoped_lock lock(m_sleep_mutex);
+        m_stop = true;
+    }
+    m_sleep_condition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    if (s_thread_owner == this)
+    {
+        s_thread_owner = nullptr;
+    }
+}
+
+void JobSystem::execute(std::function<void()> function, JobCounter* counter)
+{
+    if (counter)
+    {
+        counter->m_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    schedule(new Job{std::move(function), counter});
+}
+
+void JobSystem::execute_after(JobCounter& dependency,
+    std::function<void()> function, JobCounter* counter)
+{
+    if (counter)
+    {
+        counter->m_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    auto* job = new Job{std::move(function), counter};
+    {
+        // A finishing dependency has handed over its continuations already.
+        std::scoped_lock lock(dependency.m_mutex);
+        const auto count = dependency.m_count.load(std::memory_order_acquire);
+        if ((count & ~JobCounter::s_finishing) != 0)
+        {
+            dependency.m_continuations.push_back(job);
+            return;
+        }
+    }
+    schedule(job);
+}
+
+void JobSystem::wait(const JobCounter& counter)
+{
+    PINE_PROFILE_FUNCTION();
+    // Threads outside of the pool have no deque, as only the owner of a deque
+    // may pop from it.
+    const auto thread_index = s_thread_owner == this
+        ? s_thread_index
+        : static_cast<uint32_t>(m_deques.size());
+    while (!counter.is_done())
+    {
+        if (auto* job = find_job(thread_index))
+        {
+            run_job(job);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::schedule(Job* job)
+{
+    if (s_thread_owner == this)
+    {
+        m_deques[s_thread_index]->push(job);
+    }
+    else
+    {
+        std::scoped_lock lock(m_shared_mutex);
+        m_shared_jobs.push_back(job);
+    }
+
+    // Paired with the increment of the sleeping workers in the worker loop,
+    // either the worker sees the queued job or this thread sees the sleeper.
+    m_queued_jobs.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleeping_workers.load(std::memory_order_seq_cst) > 0)
+    {
+        {
+            std::scoped_lock lock(m_sleep_mutex);
+        }
+        m_sleep_condition.notify_one();
+    }
+}
+
+void JobSystem::run_job(Job* job)
+{
+    m_queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+    job->function();
+    if (job->counter)
+    {
+        finish_job(*job->counter);
+    }
+    delete job;
+}
+
+void JobSystem::finish_job(JobCounter& counter)
+{
+    // A waiter may destroy the counter as soon as it reads zero, so the last
+    // job takes the continuations while the counter is finishing, and clears
+    // the finishing flag as its last access.
+    std::vector<Job*> continuations;
+    {
+        std::scoped_lock lock(counter.m_mutex);
+        if (counter.m_count.load(std::memory_order_relaxed) != 1)
+        {
+            counter.m_count.fetch_sub(1, std::memory_order_acq_rel);
+            return;
+        }
+        continuations.swap(counter.m_continuations);
+        counter.m_count.fetch_add(JobCounter::s_finishing - 1,
+            std::memory_order_acq_rel);
+    }
+    for (auto* job : continuations)
+    {
+        schedule(job);
+    }
+    counter.m_count.fetch_and(~JobCounter::s_finishing,
+        std::memory_order_acq_rel);
+}
+
+Job* JobSystem::find_job(const uint32_t thread_index)
+{
+    if (thread_index < m_deques.size())
+    {
+        if (auto* job = m_deques[thread_index]->pop())
+        {
+            return job;
+        }
+    }
+
+    {
+        std::scoped_lock lock(m_shared_mutex);
+        if (!m_shared_jobs.empty())
+        {
+            auto* job = m_shared_jobs.front();
+            m_shared_jobs.pop_front();
+            return job;
+        }
+    }
+
+    // Steal from the others, starting after the own deque to spread thieves.
+    const auto deque_count = static_cast<uint32_t>(m_deques.size());
+    for (uint32_t offset = 1; offset <= deque_count; offset++)
+    {
+        const auto victim = (thread_index + offset) % deque_count;
+        if (victim == thread_index)
+        {
+            continue;
+        }
+        if (auto* job = m_deques[victim]->steal())
+        {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::worker_loop(const uint32_t thread_index)
+{
+    s_thread_owner = this;
+    s_thread_index = thread_index;
+
+    static constexpr uint32_t spin_count = 64;
+    uint32_t idle_count = 0;
+    while (true)
+    {
+        if (auto* job = find_job(thread_index))
+        {
+            run_job(job);
+            idle_count = 0;
+            continue;
+        }
+
+        if (++idle_count < spin_count)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock lock(m_sleep_mutex);
+        m_sleeping_workers.fetch_add(1, std::memory_order_seq_cst);
+        m_sleep_condition.wait(lock,
+            [this]()
+            {
+                return m_queued_jobs.load(std::memory_order_seq_cst) > 0
+                    || m_stop;
+            });
+        m_sleeping_workers.fetch_sub(1, std::memory_order_relaxed);
+        idle_count = 0;
+
+        if (m_stop && m_queued_jobs.load() == 0)
+        {
+            return;
+        }
+    }
+}
+
+} // namespace pine
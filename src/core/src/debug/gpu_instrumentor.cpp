@@ -0,0 +1,39 @@
+#include "pine/debug/gpu_instrumentor.hpp"
+
+#include "pine/pch.hpp"
+#include "pine/platform/opengl/gpu_instrumentor.hpp"
+#include "pine/renderer/renderer.hpp"
+
+namespace pine
+{
+
+std::unique_ptr<GPUInstrumentor> GPUInstrumentor::s_Instance = nullptr;
+
+GPUInstrumentor& GPUInstrumentor::Get()
+{
+    if (!s_Instance)
+    {
+        s_Instance = Create();
+    }
+    return *s_Instance;
+}
+
+void GPUInstrumentor::Shutdown() { s_Instance.reset(); }
+
+std::unique_ptr<GPUInstrumentor> GPUInstrumentor::Create()
+{
+    switch (Renderer::get_api())
+    {
+    case RendererAPI::API::None:
+        PINE_CORE_ASSERT(false, "RendererAPI::None is currently not \
+				supported!");
+        return nullptr;
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLGPUInstrumentor>();
+    }
+
+    PINE_CORE_ASSERT(false, "Unknown RendererAPI!");
+    return nullptr;
+}
+
+} // namespace pine
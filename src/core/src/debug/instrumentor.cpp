@@ -0,0 +1,245 @@
+#include "pine/debug/instrumentor.hpp"
+
+#include <charconv>
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+struct Instrumentor::ThreadBuffer
+{
+    // Single producer (the owning thread), single consumer (the serializer).
+    std::unique_ptr<ProfileResult[]> Records =
+        std::make_unique<ProfileResult[]>(ThreadBufferCapacity);
+    alignas(64) std::atomic<uint64_t> Head = 0;
+    alignas(64) std::atomic<uint64_t> Tail = 0;
+    uint32_t ThreadID = 0;
+};
+
+static constexpr auto s_SerializerInterval = std::chrono::milliseconds(10);
+
+static void AppendInteger(std::string& output, const int64_t value)
+{
+    std::array<char, 24> digits;
+    const auto result =
+        std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    output.append(digits.data(), result.ptr);
+}
+
+// Appends nanoseconds as microseconds with three decimals.
+static void AppendMicroseconds(std::string& output, const int64_t nanoseconds)
+{
+    const auto fraction = nanoseconds % 1000;
+    if (nanoseconds < 0)
+    {
+        output.push_back('-');
+    }
+    AppendInteger(output, std::abs(nanoseconds / 1000));
+    output.push_back('.');
+    output.push_back(static_cast<char>('0' + std::abs(fraction) / 100));
+    output.push_back(static_cast<char>('0' + std::abs(fraction) / 10 % 10));
+    output.push_back(static_cast<char>('0' + std::abs(fraction) % 10));
+}
+
+static void AppendEscaped(std::string& output, const char* text)
+{
+    for (; *text; text++)
+    {
+        if (*text == '"' || *text == '\\')
+        {
+            output.push_back('\\');
+        }
+        output.push_back(*text);
+    }
+}
+
+void Instrumentor::BeginSession(const std::string& name,
+    const std::string& filepath)
+{
+    std::lock_guard lock(m_Mutex);
+    if (m_CurrentSession)
+    {
+        PINE_CORE_ERROR("Instrumentor::BeginSession('{0}') when session "
+                        "'{1}' already open.",
+            name,
+            m_CurrentSession->Name);
+        InternalEndSession();
+    }
+    m_OutputStream.open(filepath);
+
+    if (!m_OutputStream.is_open())
+    {
+        PINE_CORE_ERROR("Instrumentor could not open results file '{0}'",
+            filepath);
+        return;
+    }
+
+    // Discard results that were recorded after the previous session ended.
+    {
+        std::lock_guard buffers_lock(m_BuffersMutex);
+        for (auto& buffer : m_ThreadBuffers)
+        {
+            buffer->Tail.store(buffer->Head.load(std::memory_order_acquire),
+                std::memory_order_release);
+        }
+    }
+
+    m_CurrentSession =
+        std::make_unique<InstrumentationSession>(InstrumentationSession{name,
+            Now()});
+    m_DroppedCount = 0;
+    WriteHeader();
+
+    m_StopSerializer = false;
+    m_Serializer = std::thread([this]() { RunSerializer(); });
+    m_SessionActive.store(true, std::memory_order_release);
+}
+
+void Instrumentor::EndSession()
+{
+    std::lock_guard lock(m_Mutex);
+    InternalEndSession();
+}
+
+void Instrumentor::WriteProfile(const ProfileResult& result)
+{
+    if (!IsSessionActive())
+    {
+        return;
+    }
+
+    auto& buffer = GetThreadBuffer();
+    const auto head = buffer.Head.load(std::memory_order_relaxed);
+    const auto tail = buffer.Tail.load(std::memory_order_acquire);
+    if (head - tail >= ThreadBufferCapacity)
+    {
+        m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    auto& record = buffer.Records[head & (ThreadBufferCapacity - 1)];
+    record = result;
+    record.ThreadID = buffer.ThreadID;
+    buffer.Head.store(head + 1, std::memory_order_release);
+
+    // Wake the serializer early when a burst fills a buffer halfway.
+    if (head - tail == ThreadBufferCapacity / 2)
+    {
+        m_SerializerCondition.notify_one();
+    }
+}
+
+Instrumentor::ThreadBuffer& Instrumentor::GetThreadBuffer()
+{
+    // The registry shares ownership, so results of exited threads are still
+    // serialized.
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [this]()
+    {
+        auto thread_buffer = std::make_shared<ThreadBuffer>();
+        std::lock_guard lock(m_BuffersMutex);
+        thread_buffer->ThreadID = static_cast<uint32_t>(m_ThreadBuffers.size());
+        m_ThreadBuffers.push_back(thread_buffer);
+        return thread_buffer;
+    }();
+    return *buffer;
+}
+
+void Instrumentor::RunSerializer()
+{
+    std::unique_lock lock(m_SerializerMutex);
+    while (!m_StopSerializer)
+    {
+        m_SerializerCondition.wait_for(lock,
+            s_SerializerInterval,
+            [this]() { return m_StopSerializer; });
+        DrainBuffers();
+    }
+}
+
+void Instrumentor::DrainBuffers()
+{
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard lock(m_BuffersMutex);
+        buffers = m_ThreadBuffers;
+    }
+
+    const auto session_start = m_CurrentSession->Start;
+    for (auto& buffer : buffers)
+    {
+        const auto head = buffer->Head.load(std::memory_order_acquire);
+        auto tail = buffer->Tail.load(std::memory_order_relaxed);
+        for (; tail != head; tail++)
+        {
+            const auto& result =
+                buffer->Records[tail & (ThreadBufferCapacity - 1)];
+
+            // GPU results are written as a separate process so that they
+            // show up as their own track.
+            const auto gpu = result.Track == ProfileTrack::GPU;
+            m_WriteBuffer += gpu ? ",{\"cat\":\"gpu\",\"dur\":"
+                                 : ",{\"cat\":\"function\",\"dur\":";
+            AppendMicroseconds(m_WriteBuffer, result.ElapsedTime);
+            m_WriteBuffer += ",\"name\":\"";
+            AppendEscaped(m_WriteBuffer, result.Name);
+            m_WriteBuffer += gpu ? "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                                 : "\",\"ph\":\"X\",\"pid\":0,\"tid\":";
+            AppendInteger(m_WriteBuffer, gpu ? 0 : result.ThreadID);
+            m_WriteBuffer += ",\"ts\":";
+            AppendMicroseconds(m_WriteBuffer, result.Start - session_start);
+            m_WriteBuffer += "}\n";
+        }
+        buffer->Tail.store(tail, std::memory_order_release);
+    }
+
+    m_OutputStream.write(m_WriteBuffer.data(),
+        static_cast<std::streamsize>(m_WriteBuffer.size()));
+    m_WriteBuffer.clear();
+}
+
+void Instrumentor::WriteHeader()
+{
+    m_OutputStream << "{\"otherData\": {},\"traceEvents\":[{}\n";
+    m_OutputStream << ",{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,"
+                      "\"args\":{\"name\":\"CPU\"}}\n";
+    m_OutputStream << ",{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+                      "\"args\":{\"name\":\"GPU\"}}\n";
+}
+
+void Instrumentor::WriteFooter()
+{
+    m_OutputStream << "]}";
+    m_OutputStream.flush();
+}
+
+void Instrumentor::InternalEndSession()
+{
+    if (!m_CurrentSession)
+    {
+        return;
+    }
+
+    m_SessionActive.store(false, std::memory_order_release);
+    {
+        std::lock_guard lock(m_SerializerMutex);
+        m_StopSerializer = true;
+    }
+    m_SerializerCondition.notify_one();
+    m_Serializer.join();
+
+    // The serializer has stopped, drain what was recorded since its last pass.
+    DrainBuffers();
+
+    if (const auto dropped = GetDroppedCount())
+    {
+        PINE_CORE_WARN("Instrumentor dropped {0} results, buffers were full.",
+            dropped);
+    }
+
+    WriteFooter();
+    m_OutputStream.close();
+    m_CurrentSession.reset();
+}
+
+} // namespace pine
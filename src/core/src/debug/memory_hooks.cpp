@@ -0,0 +1,184 @@
+#include "pine/debug/memory_tracker.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new and delete to count heap allocations.
+// Kept in its own translation unit, so that executables with their own
+// replacements still link.
+
+#if PINE_MEMORY_TRACKING
+
+namespace
+{
+
+// Every allocation is prefixed by a header with its size, placed right before
+// the returned pointer. The header is padded to keep the alignment.
+constexpr size_t s_header_size = alignof(std::max_align_t);
+
+size_t get_header_size(const size_t alignment)
+{
+    return alignment > s_header_size ? alignment : s_header_size;
+}
+
+void* allocate(const size_t size, const size_t alignment)
+{
+    const auto header_size = get_header_size(alignment);
+    void* base = nullptr;
+    if (alignment > s_header_size)
+    {
+        // The size passed to aligned_alloc must be a multiple of the alignment.
+        const auto total_size =
+            (header_size + size + alignment - 1) & ~(alignment - 1);
+        base = std::aligned_alloc(alignment, total_size);
+    }
+    else
+    {
+        base = std::malloc(header_size + size);
+    }
+
+    if (!base)
+    {
+        return nullptr;
+    }
+
+    auto* pointer = static_cast<std::byte*>(base) + header_size;
+    *reinterpret_cast<size_t*>(pointer - sizeof(size_t)) = size;
+    pine::MemoryTracker::allocate(pine::MemoryTag::HEAP, size);
+    return pointer;
+}
+
+void* allocate_or_throw(const size_t size, const size_t alignment)
+{
+    if (auto* pointer = allocate(size, alignment))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void deallocate(void* pointer, const size_t alignment)
+{
+    if (!pointer)
+    {
+        return;
+    }
+
+    auto* bytes = static_cast<std::byte*>(pointer);
+    const auto size = *reinterpret_cast<size_t*>(bytes - sizeof(size_t));
+    pine::MemoryTracker::deallocate(pine::MemoryTag::HEAP, size);
+    std::free(bytes - get_header_size(alignment));
+}
+
+constexpr size_t s_default_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+} // namespace
+
+void* operator new(const size_t size)
+{
+    return allocate_or_throw(size, s_default_alignment);
+}
+
+void* operator new[](const size_t size)
+{
+    return allocate_or_throw(size, s_default_alignment);
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, s_default_alignment);
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size, s_default_alignment);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment)
+{
+    return allocate_or_throw(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment)
+{
+    return allocate_or_throw(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment,
+    const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment,
+    const std::nothrow_t&) noexcept
+{
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer, s_default_alignment);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer, s_default_alignment);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    deallocate(pointer, s_default_alignment);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    deallocate(pointer, s_default_alignment);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, s_default_alignment);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, s_default_alignment);
+}
+
+void operator delete(void* pointer, const std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* pointer, const std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer, size_t,
+    const std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* pointer, size_t,
+    const std::align_val_t alignment) noexcept
+{
+    deallocate(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer, const std::align_val_t alignment,
+    const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* pointer, const std::align_val_t alignment,
+    const std::nothrow_t&) noexcept
+{
+    deallocate(pointer, static_cast<size_t>(alignment));
+}
+
+#endif
@@ -0,0 +1,125 @@
+#include "pine/debug/memory_tracker.hpp"
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+namespace
+{
+
+struct TagCounters
+{
+    std::atomic<uint64_t> current_bytes = 0;
+    std::atomic<uint64_t> peak_bytes = 0;
+    std::atomic<uint64_t> allocation_count = 0;
+    std::atomic<uint64_t> deallocation_count = 0;
+    std::atomic<uint64_t> allocated_bytes = 0;
+
+    // Written by update only.
+    uint64_t last_allocation_count = 0;
+    uint64_t last_allocated_bytes = 0;
+    std::atomic<float> allocations_per_second = 0.0f;
+    std::atomic<float> allocated_bytes_per_second = 0.0f;
+};
+
+// Constant-initialized, so that it can be used by operator new before any
+// dynamic initialization.
+std::array<TagCounters, memory_tag_count> s_counters;
+std::chrono::steady_clock::time_point s_last_update;
+
+TagCounters& get_counters(const MemoryTag tag)
+{
+    return s_counters[static_cast<size_t>(tag)];
+}
+
+} // namespace
+
+void MemoryTracker::allocate(const MemoryTag tag, const uint64_t bytes)
+{
+    auto& counters = get_counters(tag);
+    counters.allocation_count.fetch_add(1, std::memory_order_relaxed);
+    counters.allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    const auto current =
+        counters.current_bytes.fetch_add(bytes, std::memory_order_relaxed)
+        + bytes;
+
+    auto peak = counters.peak_bytes.load(std::memory_order_relaxed);
+    while (current > peak
+        && !counters.peak_bytes.compare_exchange_weak(peak,
+            current,
+            std::memory_order_relaxed))
+    {
+    }
+}
+
+void MemoryTracker::deallocate(const MemoryTag tag, const uint64_t bytes)
+{
+    auto& counters = get_counters(tag);
+    counters.deallocation_count.fetch_add(1, std::memory_order_relaxed);
+    counters.current_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+MemoryStatistics MemoryTracker::get_statistics(const MemoryTag tag)
+{
+    const auto& counters = get_counters(tag);
+    MemoryStatistics statistics;
+    statistics.current_bytes = counters.current_bytes.load();
+    statistics.peak_bytes = counters.peak_bytes.load();
+    statistics.allocation_count = counters.allocation_count.load();
+    statistics.deallocation_count = counters.deallocation_count.load();
+    statistics.allocated_bytes = counters.allocated_bytes.load();
+    statistics.allocations_per_second = counters.allocations_per_second;
+    statistics.allocated_bytes_per_second =
+        counters.allocated_bytes_per_second;
+    return statistics;
+}
+
+void MemoryTracker::update()
+{
+    // The first update only records the counts.
+    const auto now = std::chrono::steady_clock::now();
+    const auto interval = s_last_update.time_since_epoch().count() > 0
+        ? std::chrono::duration<float>(now - s_last_update).count()
+        : 0.0f;
+    s_last_update = now;
+
+    for (auto& counters : s_counters)
+    {
+        const auto allocation_count = counters.allocation_count.load();
+        const auto allocated_bytes = counters.allocated_bytes.load();
+        if (interval > 0.0f)
+        {
+            counters.allocations_per_second = static_cast<float>(
+                allocation_count - counters.last_allocation_count)
+                / interval;
+            counters.allocated_bytes_per_second = static_cast<float>(
+                allocated_bytes - counters.last_allocated_bytes)
+                / interval;
+        }
+        counters.last_allocation_count = allocation_count;
+        counters.last_allocated_bytes = allocated_bytes;
+    }
+}
+
+const char* MemoryTracker::get_name(const MemoryTag tag)
+{
+    switch (tag)
+    {
+    case MemoryTag::HEAP:
+        return "Heap";
+    case MemoryTag::TEXTURE:
+        return "Textures";
+    case MemoryTag::BUFFER:
+        return "Buffers";
+    case MemoryTag::FRAMEBUFFER:
+        return "Framebuffers";
+    case MemoryTag::QUEUE:
+        return "Queues";
+    case MemoryTag::IMAGE:
+        return "Images";
+    }
+    return "Unknown";
+}
+
+} // namespace pine
@@ -0,0 +1,102 @@
+#include "pine/debug/metrics.hpp"
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+std::array<std::atomic<uint64_t>, frame_metric_count> Metrics::s_counters = {};
+std::array<MetricHistory, frame_metric_count> Metrics::s_histories = {};
+
+MetricSummary summarize(const MetricHistory& history)
+{
+    const auto count = history.get_count();
+    if (count == 0)
+    {
+        return {};
+    }
+
+    std::array<float, MetricHistory::capacity> values;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        values[i] = history.get(i);
+    }
+
+    const auto begin = values.begin();
+    const auto end = values.begin() + count;
+
+    // Largest percentile first, the values before the previous nth element
+    // are no greater than it, so every call only partitions that range.
+    auto last = end;
+    const auto percentile = [begin, &last, count](const uint32_t percent)
+    {
+        const auto nth = begin + (count - 1) * percent / 100;
+        std::nth_element(begin, nth, last);
+        last = nth;
+        return *nth;
+    };
+
+    MetricSummary summary;
+    summary.max = *std::max_element(begin, end);
+    summary.p99 = percentile(99);
+    summary.p95 = percentile(95);
+    summary.p50 = percentile(50);
+    return summary;
+}
+
+void Metrics::end_frame(const float cpu_time, const float gpu_time,
+    const float timestep)
+{
+    const auto record = [](const FrameMetric metric, const float value)
+    { s_histories[static_cast<size_t>(metric)].push(value); };
+
+    const auto take = [](const FrameMetric metric)
+    {
+        return static_cast<float>(s_counters[static_cast<size_t>(metric)]
+                                      .exchange(0, std::memory_order_relaxed));
+    };
+
+    record(FrameMetric::CPU_TIME, cpu_time);
+    record(FrameMetric::GPU_TIME, gpu_time);
+    record(FrameMetric::TIMESTEP, timestep);
+    record(FrameMetric::DRAW_CALLS, take(FrameMetric::DRAW_CALLS));
+    record(FrameMetric::UPLOADED_BYTES, take(FrameMetric::UPLOADED_BYTES));
+    record(FrameMetric::NETWORK_BYTES, take(FrameMetric::NETWORK_BYTES));
+    record(FrameMetric::FRAME_ALLOCATIONS,
+        take(FrameMetric::FRAME_ALLOCATIONS));
+    record(FrameMetric::FRAME_HEAP_ALLOCATIONS,
+        take(FrameMetric::FRAME_HEAP_ALLOCATIONS));
+    record(FrameMetric::STATE_CHANGES, take(FrameMetric::STATE_CHANGES));
+    record(FrameMetric::REDUNDANT_STATE_CHANGES,
+        take(FrameMetric::REDUNDANT_STATE_CHANGES));
+}
+
+const char* Metrics::get_name(const FrameMetric metric)
+{
+    switch (metric)
+    {
+    case FrameMetric::CPU_TIME:
+        return "CPU time (ms)";
+    case FrameMetric::GPU_TIME:
+        return "GPU time (ms)";
+    case FrameMetric::TIMESTEP:
+        return "Timestep (ms)";
+    case FrameMetric::DRAW_CALLS:
+        return "Draw calls";
+    case FrameMetric::UPLOADED_BYTES:
+        return "Uploaded bytes";
+    case FrameMetric::NETWORK_BYTES:
+        return "Network bytes";
+    case FrameMetric::FRAME_ALLOCATIONS:
+        return "Frame allocations";
+    case FrameMetric::FRAME_HEAP_ALLOCATIONS:
+        return "Frame heap allocations";
+    case FrameMetric::STATE_CHANGES:
+        return "State changes";
+    case FrameMetric::REDUNDANT_STATE_CHANGES:
+        return "Redundant state changes";
+    }
+    return "Unknown";
+}
+
+} // namespace pine
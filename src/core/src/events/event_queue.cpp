@@ -0,0 +1,17 @@
+#include "pine/events/event_queue.hpp"
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+EventQueue::~EventQueue() { clear(); }
+
+void EventQueue::clear()
+{
+    // Events are trivially destructible, so their storage is just reused.
+    m_records.clear();
+    m_arena.reset();
+}
+
+} // namespace pine
@@ -4,33 +4,70 @@
 #include <imgui.h>
 #include <backends/imgui_impl_glfw.h>
 #include <backends/imgui_impl_opengl3.h>
+#include <implot.h>
 
 // FIXME: TEMPORARY
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
 
 #include "pine/core/application.hpp"
+#include "pine/debug/gpu_instrumentor.hpp"
 #include "pine/pch.hpp"
+#include "pine/renderer/render_command.hpp"
 
 namespace pine
 {
 
+// Copy of the draw data of a frame, as ImGui reuses its draw lists for the
+// next frame while the render thread may still draw the current one.
+struct DrawDataSnapshot
+{
+    ImDrawData draw_data;
+    std::vector<ImDrawList*> draw_lists;
+
+    DrawDataSnapshot(const ImDrawData& source) : draw_data(source)
+    {
+        draw_lists.reserve(static_cast<size_t>(source.CmdListsCount));
+        for (int i = 0; i < source.CmdListsCount; i++)
+        {
+            draw_lists.push_back(source.CmdLists[i]->CloneOutput());
+        }
+        draw_data.CmdLists = draw_lists.data();
+    }
+
+    DrawDataSnapshot(const DrawDataSnapshot&) = delete;
+    DrawDataSnapshot& operator=(const DrawDataSnapshot&) = delete;
+
+    ~DrawDataSnapshot()
+    {
+        for (auto* draw_list : draw_lists)
+        {
+            IM_DELETE(draw_list);
+        }
+    }
+};
+
 std::unique_ptr<GraphicalInterface> GraphicalInterface::create(
-    Window* window)
+    Window* window, const bool enable_viewports)
 {
-    return std::make_unique<GraphicalInterface>(window);
+    return std::make_unique<GraphicalInterface>(window, enable_viewports);
 }
 
-GraphicalInterface::GraphicalInterface(Window* window)
+GraphicalInterface::GraphicalInterface(Window* window,
+    const bool enable_viewports)
     : m_window(window)
 {
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
+    ImPlot::CreateContext();
 
     auto& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
     io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
-    io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+    if (enable_viewports)
+    {
+        io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+    }
 
     ImGui::StyleColorsDark();
 
@@ -38,12 +75,17 @@ GraphicalInterface::GraphicalInterface(Window* window)
 
     ImGui_ImplGlfw_InitForOpenGL(native_window, true);
     ImGui_ImplOpenGL3_Init("#version 410");
+
+    // Created up front rather than lazily in the first frame, which may
+    // begin on a thread without the graphics context.
+    ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
 GraphicalInterface::~GraphicalInterface()
 {
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
+    ImPlot::DestroyContext();
     ImGui::DestroyContext();
 }
 
@@ -56,6 +98,8 @@ void GraphicalInterface::begin_frame()
 
 void GraphicalInterface::end_frame()
 {
+    PINE_PROFILE_FUNCTION();
+
     auto& io = ImGui::GetIO();
 
     if (m_window)
@@ -67,7 +111,22 @@ void GraphicalInterface::end_frame()
     }
 
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    if (RenderCommand::is_recording())
+    {
+        auto snapshot =
+            std::make_unique<DrawDataSnapshot>(*ImGui::GetDrawData());
+        RenderCommand::enqueue(
+            [snapshot = std::move(snapshot)]()
+            {
+                PINE_PROFILE_GPU_SCOPE("GraphicalInterface::render");
+                ImGui_ImplOpenGL3_RenderDrawData(&snapshot->draw_data);
+            });
+    }
+    else
+    {
+        PINE_PROFILE_GPU_SCOPE("GraphicalInterface::render");
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    }
 
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
     {
@@ -3,6 +3,7 @@
 #include <asio.hpp>
 
 #include "pine/core/common.hpp"
+#include "pine/debug/metrics.hpp"
 
 namespace pine
 {
@@ -21,10 +22,24 @@ void disconnect(ConnectionState& connection)
     }
 }
 
+// Messages are written as a size and a body. Without disabling Nagle's
+// algorithm, the body of a small message waits for the delayed ACK of the
+// size, which adds tens of milliseconds to every round trip.
+static void set_socket_options(ConnectionState& connection)
+{
+    asio::error_code error;
+    connection.socket.set_option(asio::ip::tcp::no_delay(true), error);
+    if (error)
+    {
+        PINE_CORE_WARN("Could not set TCP_NODELAY: {0}", error.message());
+    }
+}
+
 void connect_to_client(ConnectionState& connection)
 {
     if (is_connected(connection))
     {
+        set_socket_options(connection);
         read_message_size(connection);
     }
 }
@@ -44,6 +59,7 @@ void connect_to_server(ConnectionState& connection,
                     error.message());
                 return;
             }
+            set_socket_options(connection);
             read_message_size(connection);
         });
 }
@@ -57,7 +73,7 @@ void read_message_size(ConnectionState& connection)
     asio::async_read(connection.socket,
         asio::mutable_buffer(&*message_size.get(), sizeof(*message_size.get())),
         [&connection, message_size](const std::error_code error,
-            [[maybe_unused]] const uint64_t length)
+            const uint64_t length)
         {
             if (error)
             {
@@ -65,8 +81,9 @@ void read_message_size(ConnectionState& connection)
                 connection.socket.close();
                 return;
             }
+            Metrics::count(FrameMetric::NETWORK_BYTES, length);
 
-            if (message_size > 0)
+            if (*message_size.get() > 0)
             {
                 read_message(connection, *message_size.get());
             }
@@ -86,7 +103,7 @@ void read_message(ConnectionState& connection, const uint64_t size)
     asio::async_read(connection.socket,
         asio::mutable_buffer(message->data(), message->size()),
         [&connection, message](const std::error_code error,
-            [[maybe_unused]] const uint64_t length)
+            const uint64_t length)
         {
             if (error)
             {
@@ -94,6 +111,7 @@ void read_message(ConnectionState& connection, const uint64_t size)
                 connection.socket.close();
                 return;
             }
+            Metrics::count(FrameMetric::NETWORK_BYTES, length);
 
             connection.read_queue.push_back(std::move(*message.get()));
             read_message_size(connection);
@@ -105,7 +123,7 @@ void send(ConnectionState& connection, const uint8_t* data, const uint64_t size)
     std::vector<uint8_t> buffer(data, data + size);
 
     asio::post(connection.context,
-        [&connection, buffer]() -> void
+        [&connection, buffer = std::move(buffer)]() mutable -> void
         {
             const auto is_writing = !connection.write_queue.empty();
             connection.write_queue.push_back(std::move(buffer));
@@ -126,7 +144,7 @@ void write_message_size(ConnectionState& connection)
     asio::async_write(connection.socket,
         asio::const_buffer(&*message_size.get(), sizeof(*message_size.get())),
         [&connection, message_size](const std::error_code error,
-            [[maybe_unused]] const uint64_t length) -> void
+            const uint64_t length) -> void
         {
             if (error)
             {
@@ -134,6 +152,7 @@ void write_message_size(ConnectionState& connection)
                 connection.socket.close();
                 return;
             }
+            Metrics::count(FrameMetric::NETWORK_BYTES, length);
 
             if (*message_size.get() > 0)
             {
@@ -156,7 +175,7 @@ void write_message(ConnectionState& connection)
         asio::const_buffer(connection.write_queue.front().data(),
             connection.write_queue.front().size()),
         [&connection](const std::error_code error,
-            [[maybe_unused]] const uint64_t length) -> void
+            const uint64_t length) -> void
         {
             if (error)
             {
@@ -164,6 +183,7 @@ void write_message(ConnectionState& connection)
                 connection.socket.close();
                 return;
             }
+            Metrics::count(FrameMetric::NETWORK_BYTES, length);
 
             connection.write_queue.pop_front();
             if (!connection.write_queue.empty())
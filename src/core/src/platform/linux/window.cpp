@@ -65,9 +65,9 @@ void LinuxWindow::init()
                 *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
             data.width = static_cast<uint32_t>(width);
             data.height = static_cast<uint32_t>(height);
-            WindowResizeEvent event(static_cast<uint32_t>(width),
+            data.event_queue.push<WindowResizeEvent>(
+                static_cast<uint32_t>(width),
                 static_cast<uint32_t>(height));
-            data.event_callback(event);
         });
 
     glfwSetWindowIconifyCallback(m_window,
@@ -75,8 +75,7 @@ void LinuxWindow::init()
         {
             WindowData& data =
                 *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
-            WindowIconifyEvent event(iconified == 1);
-            data.event_callback(event);
+            data.event_queue.push<WindowIconifyEvent>(iconified == 1);
         });
 
     glfwSetWindowCloseCallback(m_window,
@@ -84,8 +83,7 @@ void LinuxWindow::init()
         {
             WindowData& data =
                 *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
-            WindowCloseEvent event;
-            data.event_callback(event);
+            data.event_queue.push<WindowCloseEvent>();
         });
 
     glfwSetKeyCallback(m_window,
@@ -101,20 +99,22 @@ void LinuxWindow::init()
             {
             case GLFW_PRESS:
             {
-                KeyPressedEvent event(static_cast<KeyCode>(key), 0);
-                data.event_callback(event);
+                data.event_queue.push<KeyPressedEvent>(
+                    static_cast<KeyCode>(key),
+                    0);
                 break;
             }
             case GLFW_RELEASE:
             {
-                KeyReleasedEvent event(static_cast<KeyCode>(key));
-                data.event_callback(event);
+                data.event_queue.push<KeyReleasedEvent>(
+                    static_cast<KeyCode>(key));
                 break;
             }
             case GLFW_REPEAT:
             {
-                KeyPressedEvent event(static_cast<KeyCode>(key), 1);
-                data.event_callback(event);
+                data.event_queue.push<KeyPressedEvent>(
+                    static_cast<KeyCode>(key),
+                    1);
                 break;
             }
             }
@@ -125,8 +125,7 @@ void LinuxWindow::init()
         {
             WindowData& data =
                 *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
-            KeyTypedEvent event(static_cast<KeyCode>(key));
-            data.event_callback(event);
+            data.event_queue.push<KeyTypedEvent>(static_cast<KeyCode>(key));
         });
 
     glfwSetMouseButtonCallback(m_window,
@@ -141,14 +140,14 @@ void LinuxWindow::init()
             {
             case GLFW_PRESS:
             {
-                MouseButtonPressedEvent event(static_cast<MouseCode>(button));
-                data.event_callback(event);
+                data.event_queue.push<MouseButtonPressedEvent>(
+                    static_cast<MouseCode>(button));
                 break;
             }
             case GLFW_RELEASE:
             {
-                MouseButtonReleasedEvent event(static_cast<MouseCode>(button));
-                data.event_callback(event);
+                data.event_queue.push<MouseButtonReleasedEvent>(
+                    static_cast<MouseCode>(button));
                 break;
             }
             }
@@ -159,9 +158,9 @@ void LinuxWindow::init()
         {
             WindowData& data =
                 *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
-            MouseScrolledEvent event(static_cast<float>(offset_x),
+            data.event_queue.push<MouseScrolledEvent>(
+                static_cast<float>(offset_x),
                 static_cast<float>(offset_y));
-            data.event_callback(event);
         });
 
     glfwSetCursorPosCallback(m_window,
@@ -169,14 +168,20 @@ void LinuxWindow::init()
         {
             WindowData& data =
                 *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
-            MouseMovedEvent event(static_cast<float>(pos_x),
+            data.event_queue.push<MouseMovedEvent>(static_cast<float>(pos_x),
                 static_cast<float>(pos_y));
-            data.event_callback(event);
         });
 }
 
 void LinuxWindow::poll_events() { glfwPollEvents(); }
 
+void LinuxWindow::wait_events(const double timeout)
+{
+    glfwWaitEventsTimeout(timeout);
+}
+
+void LinuxWindow::post_empty_event() { glfwPostEmptyEvent(); }
+
 void LinuxWindow::swap_buffers() { m_context->swap_buffers(); }
 
 std::pair<uint32_t, uint32_t> LinuxWindow::get_size() const
@@ -201,11 +206,6 @@ void LinuxWindow::center_window()
     glfwSetWindowPos(m_window, x, y);
 }
 
-void LinuxWindow::set_event_callback(const EventCallbackFn& callback)
-{
-    m_data.event_callback = callback;
-}
-
 void LinuxWindow::set_vsync(const bool enabled)
 {
     if (enabled)
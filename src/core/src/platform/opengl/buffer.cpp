@@ -2,10 +2,13 @@
 
 #include <glad/glad.h>
 
+#include "pine/debug/memory_tracker.hpp"
+#include "pine/debug/metrics.hpp"
 #include "pine/pch.hpp"
 #include "pine/renderer/common.hpp"
 
 #include "pine/platform/opengl/common.hpp"
+#include "pine/platform/opengl/state_cache.hpp"
 
 namespace pine
 {
@@ -14,55 +17,85 @@ namespace pine
 // ---- Vertex buffer ---------------------------------------------------------
 // ----------------------------------------------------------------------------
 
-OpenGLVertexBuffer::OpenGLVertexBuffer(const uint32_t size)
+OpenGLVertexBuffer::OpenGLVertexBuffer(const uint32_t size) : m_size(size)
 {
+    OpenGLStateCache::assert_context_thread();
     glCreateBuffers(1, &m_renderer_id);
-    glBindBuffer(GL_ARRAY_BUFFER, m_renderer_id);
-    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    glNamedBufferData(m_renderer_id, size, nullptr, GL_DYNAMIC_DRAW);
+    PINE_TRACK_ALLOCATION(MemoryTag::BUFFER, m_size);
 }
 
 OpenGLVertexBuffer::OpenGLVertexBuffer(const float* vertices, uint32_t size)
+    : m_size(size)
 {
+    OpenGLStateCache::assert_context_thread();
     glCreateBuffers(1, &m_renderer_id);
-    glBindBuffer(GL_ARRAY_BUFFER, m_renderer_id);
-    glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+    glNamedBufferData(m_renderer_id, size, vertices, GL_STATIC_DRAW);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, size);
+    PINE_TRACK_ALLOCATION(MemoryTag::BUFFER, m_size);
 }
 
 OpenGLVertexBuffer::~OpenGLVertexBuffer()
 {
     glDeleteBuffers(1, &m_renderer_id);
+    OpenGLStateCache::forget_buffer(m_renderer_id);
+    PINE_TRACK_DEALLOCATION(MemoryTag::BUFFER, m_size);
 }
 
 void OpenGLVertexBuffer::bind() const
 {
-    glBindBuffer(GL_ARRAY_BUFFER, m_renderer_id);
+    OpenGLStateCache::bind_buffer(GL_ARRAY_BUFFER, m_renderer_id);
 }
 
-void OpenGLVertexBuffer::unbind() const { glBindBuffer(GL_ARRAY_BUFFER, 0); }
+void OpenGLVertexBuffer::unbind() const
+{
+    OpenGLStateCache::bind_buffer(GL_ARRAY_BUFFER, 0);
+}
 
-void OpenGLVertexBuffer::set_data(const void* data, const uint32_t size)
+void OpenGLVertexBuffer::set_data(const void* data, const uint32_t size,
+    const uint32_t offset)
 {
-    glBindBuffer(GL_ARRAY_BUFFER, m_renderer_id);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+    OpenGLStateCache::assert_context_thread();
+    PINE_CORE_ASSERT(offset + size <= m_size, "Vertex buffer overflow.");
+    glNamedBufferSubData(m_renderer_id, offset, size, data);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, size);
 }
 
 // ----------------------------------------------------------------------------
 // ---- Index buffer ----------------------------------------------------------
 // ----------------------------------------------------------------------------
 
+OpenGLIndexBuffer::OpenGLIndexBuffer(const uint32_t count) : m_count(count)
+{
+    OpenGLStateCache::assert_context_thread();
+    glCreateBuffers(1, &m_renderer_id);
+    glNamedBufferData(m_renderer_id,
+        static_cast<GLsizeiptr>(count * sizeof(uint32_t)),
+        nullptr,
+        GL_DYNAMIC_DRAW);
+    PINE_TRACK_ALLOCATION(MemoryTag::BUFFER, count * sizeof(uint32_t));
+}
+
 OpenGLIndexBuffer::OpenGLIndexBuffer(const uint32_t* indices,
     const uint32_t count)
     : m_count(count)
 {
+    OpenGLStateCache::assert_context_thread();
     glCreateBuffers(1, &m_renderer_id);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_renderer_id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+    glNamedBufferData(m_renderer_id,
         static_cast<GLsizeiptr>(count * sizeof(uint32_t)),
         indices,
         GL_STATIC_DRAW);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, count * sizeof(uint32_t));
+    PINE_TRACK_ALLOCATION(MemoryTag::BUFFER, count * sizeof(uint32_t));
 }
 
-OpenGLIndexBuffer::~OpenGLIndexBuffer() { glDeleteBuffers(1, &m_renderer_id); }
+OpenGLIndexBuffer::~OpenGLIndexBuffer()
+{
+    glDeleteBuffers(1, &m_renderer_id);
+    OpenGLStateCache::forget_buffer(m_renderer_id);
+    PINE_TRACK_DEALLOCATION(MemoryTag::BUFFER, m_count * sizeof(uint32_t));
+}
 
 void OpenGLIndexBuffer::bind() const
 {
@@ -74,27 +107,160 @@ void OpenGLIndexBuffer::unbind() const
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
+void OpenGLIndexBuffer::set_data(const uint32_t* indices, const uint32_t count,
+    const uint32_t offset)
+{
+    OpenGLStateCache::assert_context_thread();
+    PINE_CORE_ASSERT(offset + count <= m_count, "Index buffer overflow.");
+    glNamedBufferSubData(m_renderer_id,
+        static_cast<GLintptr>(offset * sizeof(uint32_t)),
+        static_cast<GLsizeiptr>(count * sizeof(uint32_t)),
+        indices);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, count * sizeof(uint32_t));
+}
+
+// ----------------------------------------------------------------------------
+// ---- Uniform buffer --------------------------------------------------------
+// ----------------------------------------------------------------------------
+
+OpenGLUniformBuffer::OpenGLUniformBuffer(const uint32_t size,
+    const uint32_t binding)
+    : m_size(size), m_binding(binding)
+{
+    OpenGLStateCache::assert_context_thread();
+    glCreateBuffers(1, &m_renderer_id);
+    glNamedBufferData(m_renderer_id, size, nullptr, GL_DYNAMIC_DRAW);
+    OpenGLStateCache::bind_buffer_base(GL_UNIFORM_BUFFER,
+        m_binding,
+        m_renderer_id);
+    PINE_TRACK_ALLOCATION(MemoryTag::BUFFER, m_size);
+}
+
+OpenGLUniformBuffer::~OpenGLUniformBuffer()
+{
+    glDeleteBuffers(1, &m_renderer_id);
+    OpenGLStateCache::forget_buffer(m_renderer_id);
+    PINE_TRACK_DEALLOCATION(MemoryTag::BUFFER, m_size);
+}
+
+void OpenGLUniformBuffer::set_data(const void* data, const uint32_t size,
+    const uint32_t offset)
+{
+    OpenGLStateCache::assert_context_thread();
+    PINE_CORE_ASSERT(offset + size <= m_size, "Uniform buffer overflow.");
+    glNamedBufferSubData(m_renderer_id, offset, size, data);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, size);
+}
+
+// ----------------------------------------------------------------------------
+// ---- Storage buffer --------------------------------------------------------
+// ----------------------------------------------------------------------------
+
+OpenGLStorageBuffer::OpenGLStorageBuffer(const uint32_t size,
+    const uint32_t binding)
+    : m_size(size), m_binding(binding)
+{
+    OpenGLStateCache::assert_context_thread();
+    glCreateBuffers(1, &m_renderer_id);
+    glNamedBufferData(m_renderer_id, size, nullptr, GL_DYNAMIC_DRAW);
+    OpenGLStateCache::bind_buffer_base(GL_SHADER_STORAGE_BUFFER,
+        m_binding,
+        m_renderer_id);
+    PINE_TRACK_ALLOCATION(MemoryTag::BUFFER, m_size);
+}
+
+OpenGLStorageBuffer::~OpenGLStorageBuffer()
+{
+    glDeleteBuffers(1, &m_renderer_id);
+    OpenGLStateCache::forget_buffer(m_renderer_id);
+    PINE_TRACK_DEALLOCATION(MemoryTag::BUFFER, m_size);
+}
+
+void OpenGLStorageBuffer::bind() const
+{
+    OpenGLStateCache::bind_buffer_base(GL_SHADER_STORAGE_BUFFER,
+        m_binding,
+        m_renderer_id);
+}
+
+void OpenGLStorageBuffer::set_data(const void* data, const uint32_t size,
+    const uint32_t offset)
+{
+    OpenGLStateCache::assert_context_thread();
+    PINE_CORE_ASSERT(offset + size <= m_size, "Storage buffer overflow.");
+    glNamedBufferSubData(m_renderer_id, offset, size, data);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, size);
+}
+
+// ----------------------------------------------------------------------------
+// ---- Indirect buffer -------------------------------------------------------
+// ----------------------------------------------------------------------------
+
+OpenGLIndirectBuffer::OpenGLIndirectBuffer(const uint32_t size) : m_size(size)
+{
+    OpenGLStateCache::assert_context_thread();
+    glCreateBuffers(1, &m_renderer_id);
+    glNamedBufferData(m_renderer_id, size, nullptr, GL_DYNAMIC_DRAW);
+    PINE_TRACK_ALLOCATION(MemoryTag::BUFFER, m_size);
+}
+
+OpenGLIndirectBuffer::~OpenGLIndirectBuffer()
+{
+    glDeleteBuffers(1, &m_renderer_id);
+    OpenGLStateCache::forget_buffer(m_renderer_id);
+    PINE_TRACK_DEALLOCATION(MemoryTag::BUFFER, m_size);
+}
+
+void OpenGLIndirectBuffer::bind() const
+{
+    OpenGLStateCache::bind_buffer(GL_DRAW_INDIRECT_BUFFER, m_renderer_id);
+}
+
+void OpenGLIndirectBuffer::bind_base(const uint32_t binding) const
+{
+    OpenGLStateCache::bind_buffer_base(GL_SHADER_STORAGE_BUFFER,
+        binding,
+        m_renderer_id);
+}
+
+void OpenGLIndirectBuffer::set_data(const void* data, const uint32_t size,
+    const uint32_t offset)
+{
+    OpenGLStateCache::assert_context_thread();
+    PINE_CORE_ASSERT(offset + size <= m_size, "Indirect buffer overflow.");
+    glNamedBufferSubData(m_renderer_id, offset, size, data);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, size);
+}
+
 // ----------------------------------------------------------------------------
 // ---- Vertex array ----------------------------------------------------------
 // ----------------------------------------------------------------------------
 
 OpenGLVertexArray::OpenGLVertexArray()
 {
+    OpenGLStateCache::assert_context_thread();
     glCreateVertexArrays(1, &m_renderer_id);
 }
 
 OpenGLVertexArray::~OpenGLVertexArray()
 {
     glDeleteVertexArrays(1, &m_renderer_id);
+    OpenGLStateCache::forget_vertex_array(m_renderer_id);
 }
 
-void OpenGLVertexArray::bind() const { glBindVertexArray(m_renderer_id); }
+void OpenGLVertexArray::bind() const
+{
+    OpenGLStateCache::bind_vertex_array(m_renderer_id);
+}
 
-void OpenGLVertexArray::unbind() const { glBindVertexArray(0); }
+void OpenGLVertexArray::unbind() const
+{
+    OpenGLStateCache::bind_vertex_array(0);
+}
 
 void OpenGLVertexArray::set_vertex_buffer(std::unique_ptr<VertexBuffer> buffer)
 {
-    glBindVertexArray(m_renderer_id);
+    OpenGLStateCache::bind_vertex_array(m_renderer_id);
     buffer->bind();
 
     PINE_CORE_ASSERT(buffer->get_layout().get_elements().size(),
@@ -130,7 +296,7 @@ void OpenGLVertexArray::set_vertex_buffer(std::unique_ptr<VertexBuffer> buffer)
 
 void OpenGLVertexArray::set_index_buffer(std::unique_ptr<IndexBuffer> buffer)
 {
-    glBindVertexArray(m_renderer_id);
+    OpenGLStateCache::bind_vertex_array(m_renderer_id);
     buffer->bind();
     m_index_buffer.reset(buffer.release());
 }
@@ -5,6 +5,7 @@
 #include "pine/core/common.hpp"
 #include "pine/core/log.hpp"
 #include "pine/pch.hpp"
+#include "pine/platform/opengl/state_cache.hpp"
 
 namespace pine
 {
@@ -21,6 +22,7 @@ void OpenGLContext::init()
     [[maybe_unused]] const auto status =
         gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
     PINE_CORE_ASSERT(status, "Failed to initialize Glad!")
+    OpenGLStateCache::invalidate();
 
     PINE_CORE_INFO("OpenGL Info:");
     PINE_CORE_INFO(" - Vendor:   {0}", glGetString(GL_VENDOR));
@@ -40,4 +42,8 @@ void OpenGLContext::init()
 
 void OpenGLContext::swap_buffers() { glfwSwapBuffers(m_window_handle); }
 
+void OpenGLContext::make_current() { glfwMakeContextCurrent(m_window_handle); }
+
+void OpenGLContext::release() { glfwMakeContextCurrent(nullptr); }
+
 } // namespace pine
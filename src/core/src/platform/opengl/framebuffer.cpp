@@ -2,95 +2,349 @@
 
 #include <glad/glad.h>
 
+#include "pine/debug/memory_tracker.hpp"
 #include "pine/pch.hpp"
+#include "pine/platform/opengl/state_cache.hpp"
 
 namespace pine
 {
 
 static constexpr uint32_t s_max_framebuffer_size = 8192;
+static constexpr uint32_t s_capacity_granularity = 256;
+
+static constexpr GLenum to_opengl(const FramebufferTextureFormat format)
+{
+    switch (format)
+    {
+    case FramebufferTextureFormat::NONE:
+        return GL_NONE;
+    case FramebufferTextureFormat::RGBA8:
+        return GL_RGBA8;
+    case FramebufferTextureFormat::RGBA16F:
+        return GL_RGBA16F;
+    case FramebufferTextureFormat::R32UI:
+        return GL_R32UI;
+    case FramebufferTextureFormat::DEPTH24_STENCIL8:
+        return GL_DEPTH24_STENCIL8;
+    }
+    return GL_NONE;
+}
+
+static constexpr uint64_t get_bytes_per_pixel(const GLenum format)
+{
+    switch (format)
+    {
+    case GL_RGBA16F:
+        return 8;
+    default:
+        return 4;
+    }
+}
+
+static constexpr uint64_t get_attachment_size(const OpenGLAttachmentKey& key)
+{
+    return get_bytes_per_pixel(key.format) * key.width * key.height
+        * key.samples;
+}
+
+static constexpr uint32_t get_capacity(const uint32_t size)
+{
+    const auto capacity = (std::max(size, 1u) + s_capacity_granularity - 1)
+        / s_capacity_granularity * s_capacity_granularity;
+    return std::min(capacity, s_max_framebuffer_size);
+}
+
+// ----------------------------------------------------------------------------
+// ---- Attachment pool -------------------------------------------------------
+// ----------------------------------------------------------------------------
+
+OpenGLAttachmentPool& OpenGLAttachmentPool::get()
+{
+    static OpenGLAttachmentPool pool;
+    return pool;
+}
+
+RendererID OpenGLAttachmentPool::acquire(const OpenGLAttachmentKey& key)
+{
+    const auto it = std::find_if(m_attachments.begin(),
+        m_attachments.end(),
+        [&key](const Attachment& attachment) { return attachment.key == key; });
+    if (it != m_attachments.end())
+    {
+        const auto renderer_id = it->renderer_id;
+        m_attachments.erase(it);
+        return renderer_id;
+    }
+
+    RendererID renderer_id = 0;
+    if (key.renderbuffer)
+    {
+        glCreateRenderbuffers(1, &renderer_id);
+        glNamedRenderbufferStorageMultisample(renderer_id,
+            static_cast<GLsizei>(key.samples > 1 ? key.samples : 0),
+            key.format,
+            static_cast<GLsizei>(key.width),
+            static_cast<GLsizei>(key.height));
+    }
+    else
+    {
+        // Integer textures can only be sampled with nearest filtering.
+        const auto filter = key.format == GL_R32UI ? GL_NEAREST : GL_LINEAR;
+        glCreateTextures(GL_TEXTURE_2D, 1, &renderer_id);
+        glTextureStorage2D(renderer_id,
+            1,
+            key.format,
+            static_cast<GLsizei>(key.width),
+            static_cast<GLsizei>(key.height));
+        glTextureParameteri(renderer_id, GL_TEXTURE_MIN_FILTER, filter);
+        glTextureParameteri(renderer_id, GL_TEXTURE_MAG_FILTER, filter);
+    }
+    PINE_TRACK_ALLOCATION(MemoryTag::FRAMEBUFFER, get_attachment_size(key));
+    return renderer_id;
+}
+
+void OpenGLAttachmentPool::release(const OpenGLAttachmentKey& key,
+    const RendererID renderer_id)
+{
+    // Evict the least recently released attachment when the pool is full.
+    if (m_attachments.size() >= s_max_attachment_count)
+    {
+        destroy(m_attachments.front());
+        m_attachments.erase(m_attachments.begin());
+    }
+    m_attachments.push_back({key, renderer_id});
+}
+
+void OpenGLAttachmentPool::destroy(const Attachment& attachment)
+{
+    if (attachment.key.renderbuffer)
+    {
+        glDeleteRenderbuffers(1, &attachment.renderer_id);
+    }
+    else
+    {
+        glDeleteTextures(1, &attachment.renderer_id);
+        OpenGLStateCache::forget_texture(attachment.renderer_id);
+    }
+    PINE_TRACK_DEALLOCATION(MemoryTag::FRAMEBUFFER,
+        get_attachment_size(attachment.key));
+}
+
+// ----------------------------------------------------------------------------
+// ---- Framebuffer -----------------------------------------------------------
+// ----------------------------------------------------------------------------
 
 OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpecs& specs)
     : m_specification(specs)
 {
+    m_specification.samples = std::max(m_specification.samples, 1u);
+
+    glCreateFramebuffers(1, &m_renderer_id);
+    if (m_specification.samples > 1)
+    {
+        glCreateFramebuffers(1, &m_resolve_id);
+    }
     invalidate();
 }
 
 OpenGLFramebuffer::~OpenGLFramebuffer()
 {
+    release_attachments();
     glDeleteFramebuffers(1, &m_renderer_id);
-    glDeleteTextures(1, &m_color_attachment);
-    glDeleteTextures(1, &m_depth_attachment);
+    OpenGLStateCache::forget_framebuffer(m_renderer_id);
+    if (m_resolve_id)
+    {
+        glDeleteFramebuffers(1, &m_resolve_id);
+    }
 }
 
 void OpenGLFramebuffer::invalidate()
 {
-    if (m_renderer_id)
+    OpenGLStateCache::assert_context_thread();
+    release_attachments();
+
+    m_capacity_width = get_capacity(m_specification.width);
+    m_capacity_height = get_capacity(m_specification.height);
+
+    auto& pool = OpenGLAttachmentPool::get();
+    const auto samples = m_specification.samples;
+    for (const auto& specs : m_specification.format.attachments)
     {
-        glDeleteFramebuffers(1, &m_renderer_id);
-        glDeleteTextures(1, &m_color_attachment);
-        glDeleteTextures(1, &m_depth_attachment);
+        Attachment attachment;
+        attachment.specs = specs;
+
+        const auto format = to_opengl(specs.format);
+        attachment.key = {format,
+            m_capacity_width,
+            m_capacity_height,
+            samples,
+            samples > 1 || !specs.sampled};
+        attachment.renderer_id = pool.acquire(attachment.key);
+
+        if (samples > 1 && specs.sampled)
+        {
+            attachment.resolve_key =
+                {format, m_capacity_width, m_capacity_height, 1, false};
+            attachment.resolve_id = pool.acquire(attachment.resolve_key);
+        }
+
+        const auto attachment_point = is_depth_format(specs.format)
+            ? GL_DEPTH_STENCIL_ATTACHMENT
+            : GL_COLOR_ATTACHMENT0
+                + static_cast<GLenum>(m_color_attachments.size());
+
+        if (attachment.key.renderbuffer)
+        {
+            glNamedFramebufferRenderbuffer(m_renderer_id,
+                attachment_point,
+                GL_RENDERBUFFER,
+                attachment.renderer_id);
+        }
+        else
+        {
+            glNamedFramebufferTexture(m_renderer_id,
+                attachment_point,
+                attachment.renderer_id,
+                0);
+        }
+
+        if (attachment.resolve_id)
+        {
+            glNamedFramebufferTexture(m_resolve_id,
+                attachment_point,
+                attachment.resolve_id,
+                0);
+        }
+
+        if (is_depth_format(specs.format))
+        {
+            m_depth_attachment = attachment;
+        }
+        else
+        {
+            m_color_attachments.push_back(attachment);
+        }
     }
-    glCreateFramebuffers(1, &m_renderer_id);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_renderer_id);
 
-    // Color attachment.
-    glCreateTextures(GL_TEXTURE_2D, 1, &m_color_attachment);
-    glBindTexture(GL_TEXTURE_2D, m_color_attachment);
-    glTexImage2D(GL_TEXTURE_2D,
-        0,
-        GL_RGBA8,
-        static_cast<GLsizei>(m_specification.width),
-        static_cast<GLsizei>(m_specification.height),
-        0,
-        GL_RGBA,
-        GL_UNSIGNED_BYTE,
-        nullptr);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glFramebufferTexture2D(GL_FRAMEBUFFER,
-        GL_COLOR_ATTACHMENT0,
-        GL_TEXTURE_2D,
-        m_color_attachment,
-        0);
-
-    // Depth attachment.
-    glCreateTextures(GL_TEXTURE_2D, 1, &m_depth_attachment);
-    glBindTexture(GL_TEXTURE_2D, m_depth_attachment);
-    glTexStorage2D(GL_TEXTURE_2D,
-        1,
-        GL_DEPTH24_STENCIL8,
-        static_cast<GLsizei>(m_specification.width),
-        static_cast<GLsizei>(m_specification.height));
-    glFramebufferTexture2D(GL_FRAMEBUFFER,
-        GL_DEPTH_STENCIL_ATTACHMENT,
-        GL_TEXTURE_2D,
-        m_depth_attachment,
-        0);
+    std::vector<GLenum> draw_buffers;
+    for (size_t index = 0; index < m_color_attachments.size(); index++)
+    {
+        draw_buffers.push_back(
+            GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(index));
+    }
+    if (draw_buffers.empty())
+    {
+        glNamedFramebufferDrawBuffer(m_renderer_id, GL_NONE);
+    }
+    else
+    {
+        glNamedFramebufferDrawBuffers(m_renderer_id,
+            static_cast<GLsizei>(draw_buffers.size()),
+            draw_buffers.data());
+    }
 
-    PINE_CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER)
+    PINE_CORE_ASSERT(
+        glCheckNamedFramebufferStatus(m_renderer_id, GL_FRAMEBUFFER)
             == GL_FRAMEBUFFER_COMPLETE,
         "Framebuffer is incomplete!");
+}
+
+void OpenGLFramebuffer::resolve()
+{
+    if (!m_resolve_id)
+    {
+        return;
+    }
+
+    const auto width = static_cast<GLint>(m_specification.width);
+    const auto height = static_cast<GLint>(m_specification.height);
+    for (size_t index = 0; index < m_color_attachments.size(); index++)
+    {
+        if (!m_color_attachments[index].resolve_id)
+        {
+            continue;
+        }
+
+        const auto attachment_point =
+            GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(index);
+        glNamedFramebufferReadBuffer(m_renderer_id, attachment_point);
+        glNamedFramebufferDrawBuffer(m_resolve_id, attachment_point);
+        glBlitNamedFramebuffer(m_renderer_id,
+            m_resolve_id,
+            0,
+            0,
+            width,
+            height,
+            0,
+            0,
+            width,
+            height,
+            GL_COLOR_BUFFER_BIT,
+            GL_NEAREST);
+    }
+
+    if (m_depth_attachment && m_depth_attachment->resolve_id)
+    {
+        glBlitNamedFramebuffer(m_renderer_id,
+            m_resolve_id,
+            0,
+            0,
+            width,
+            height,
+            0,
+            0,
+            width,
+            height,
+            GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT,
+            GL_NEAREST);
+    }
+}
+
+void OpenGLFramebuffer::release_attachments()
+{
+    auto& pool = OpenGLAttachmentPool::get();
+    const auto release = [&pool](const Attachment& attachment)
+    {
+        pool.release(attachment.key, attachment.renderer_id);
+        if (attachment.resolve_id)
+        {
+            pool.release(attachment.resolve_key, attachment.resolve_id);
+        }
+    };
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    for (const auto& attachment : m_color_attachments)
+    {
+        release(attachment);
+    }
+    if (m_depth_attachment)
+    {
+        release(*m_depth_attachment);
+    }
+    m_color_attachments.clear();
+    m_depth_attachment.reset();
 }
 
 void OpenGLFramebuffer::bind()
 {
-    glBindFramebuffer(GL_FRAMEBUFFER, m_renderer_id);
-    glViewport(0,
+    OpenGLStateCache::bind_framebuffer(m_renderer_id);
+    OpenGLStateCache::set_viewport(0,
         0,
         static_cast<GLsizei>(m_specification.width),
         static_cast<GLsizei>(m_specification.height));
 }
 
-void OpenGLFramebuffer::unbind() { glBindFramebuffer(GL_FRAMEBUFFER, 0); }
-
+void OpenGLFramebuffer::unbind()
+{
+    OpenGLStateCache::bind_framebuffer(0);
+    resolve();
+}
 void OpenGLFramebuffer::resize(const uint32_t width, const uint32_t height)
 {
+    OpenGLStateCache::assert_context_thread();
     if (width == 0 || height == 0 || width > s_max_framebuffer_size
         || height > s_max_framebuffer_size)
     {
-        PINE_CORE_WARN("Attempted to resize framebuffer to {0}, {1}",
+        PINE_CORE_WARN("Attempted to resize framebuffer to {0}, {1}",
             width,
             height);
         return;
@@ -99,7 +353,102 @@ void OpenGLFramebuffer::resize(const uint32_t width, const uint32_t height)
     m_specification.width = width;
     m_specification.height = height;
 
-    invalidate();
+    // Reallocate when the size outgrows the capacity, or when it shrinks to
+    // less than half of it, so that memory is eventually returned.
+    const auto capacity_width = get_capacity(width);
+    const auto capacity_height = get_capacity(height);
+    if (capacity_width > m_capacity_width
+        || capacity_height > m_capacity_height
+        || capacity_width * 2 <= m_capacity_width
+        || capacity_height * 2 <= m_capacity_height)
+    {
+        invalidate();
+    }
+}
+
+RendererID OpenGLFramebuffer::get_color_attachment_renderer_id(
+    const uint32_t index) const
+{
+    PINE_CORE_ASSERT(index < m_color_attachments.size(),
+        "Invalid color attachment index.");
+    return get_sampled_id(m_color_attachments[index]);
+}
+
+Image OpenGLFramebuffer::read_color_attachment() const
+{
+    OpenGLStateCache::assert_context_thread();
+    // Integer formats cannot be converted to normalized bytes.
+    PINE_CORE_ASSERT(!m_color_attachments.empty()
+            && m_color_attachments.front().specs.sampled
+            && (m_color_attachments.front().specs.format
+                    == FramebufferTextureFormat::RGBA8
+                || m_color_attachments.front().specs.format
+                    == FramebufferTextureFormat::RGBA16F),
+        "Colors can only be read from sampled RGBA8 or RGBA16F attachments.");
+
+    const auto width = m_specification.width;
+    const auto height = m_specification.height;
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glGetTextureSubImage(get_sampled_id(m_color_attachments.front()),
+        0,
+        0,
+        0,
+        0,
+        static_cast<GLsizei>(width),
+        static_cast<GLsizei>(height),
+        1,
+        GL_RGBA,
+        GL_UNSIGNED_BYTE,
+        static_cast<GLsizei>(pixels.size()),
+        pixels.data());
+
+    return Image(pixels.data(), width, height, ImageFormat::RGBA);
+}
+
+uint32_t OpenGLFramebuffer::read_pixel(const uint32_t index,
+    const uint32_t x, const uint32_t y) const
+{
+    OpenGLStateCache::assert_context_thread();
+    PINE_CORE_ASSERT(index < m_color_attachments.size()
+            && m_color_attachments[index].specs.format
+                == FramebufferTextureFormat::R32UI
+            && m_color_attachments[index].specs.sampled,
+        "Pixels can only be read from sampled R32UI attachments.");
+
+    GLuint value = 0;
+    if (x < m_specification.width && y < m_specification.height)
+    {
+        glGetTextureSubImage(get_sampled_id(m_color_attachments[index]),
+            0,
+            static_cast<GLint>(x),
+            static_cast<GLint>(y),
+            0,
+            1,
+            1,
+            1,
+            GL_RED_INTEGER,
+            GL_UNSIGNED_INT,
+            sizeof(value),
+            &value);
+    }
+    return value;
+}
+
+void OpenGLFramebuffer::clear_attachment(const uint32_t index,
+    const uint32_t value)
+{
+    PINE_CORE_ASSERT(index < m_color_attachments.size()
+            && m_color_attachments[index].specs.format
+                == FramebufferTextureFormat::R32UI,
+        "Only R32UI attachments can be cleared to a value.");
+
+    const std::array<GLuint, 4> values = {value, 0, 0, 0};
+    glClearNamedFramebufferuiv(m_renderer_id,
+        GL_COLOR,
+        static_cast<GLint>(index),
+        values.data());
 }
 
 } // namespace pine
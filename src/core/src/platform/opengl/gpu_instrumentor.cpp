@@ -0,0 +1,161 @@
+#include "pine/platform/opengl/gpu_instrumentor.hpp"
+
+#include <glad/glad.h>
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+OpenGLGPUInstrumentor::OpenGLGPUInstrumentor()
+{
+    m_queries.resize(s_frame_latency * s_max_frame_scopes * 2);
+    glGenQueries(static_cast<GLsizei>(m_queries.size()), m_queries.data());
+    calibrate();
+}
+
+OpenGLGPUInstrumentor::~OpenGLGPUInstrumentor()
+{
+    if (m_dropped_frames)
+    {
+        PINE_CORE_WARN("GPU instrumentor dropped {0} frames of queries.",
+            m_dropped_frames);
+    }
+    glDeleteQueries(static_cast<GLsizei>(m_queries.size()), m_queries.data());
+}
+
+uint32_t OpenGLGPUInstrumentor::get_start_query(const uint32_t frame,
+    const uint32_t scope)
+{
+    return (frame * s_max_frame_scopes + scope) * 2;
+}
+
+uint32_t OpenGLGPUInstrumentor::BeginQuery(const char* name)
+{
+    auto& frame = m_frames[m_frame_index];
+    if (frame.count >= s_max_frame_scopes)
+    {
+        return InvalidQuery;
+    }
+
+    const auto scope = frame.count++;
+    frame.names[scope] = name;
+    glQueryCounter(m_queries[get_start_query(m_frame_index, scope)],
+        GL_TIMESTAMP);
+    return m_frame_index * s_max_frame_scopes + scope;
+}
+
+void OpenGLGPUInstrumentor::EndQuery(const uint32_t query)
+{
+    glQueryCounter(m_queries[query * 2 + 1], GL_TIMESTAMP);
+}
+
+void OpenGLGPUInstrumentor::BeginFrame()
+{
+    auto& frame = m_frames[m_frame_index];
+    if (frame.count == 0)
+    {
+        BeginQuery("Frame");
+        frame.frame_scope = true;
+    }
+}
+
+void OpenGLGPUInstrumentor::EndFrame()
+{
+    if (m_frames[m_frame_index].frame_scope)
+    {
+        EndQuery(m_frame_index * s_max_frame_scopes);
+    }
+
+    m_frames[m_frame_index].pending = m_frames[m_frame_index].count > 0;
+    m_frame_index = (m_frame_index + 1) % s_frame_latency;
+    m_frame_count++;
+
+    if (m_frame_count % s_calibration_interval == 0)
+    {
+        calibrate();
+    }
+
+    // Resolve the oldest frames first and stop at the first frame the GPU
+    // has not finished yet. The slot for the next frame has to be freed, so
+    // its queries are discarded if they are still in flight.
+    for (uint32_t offset = 0; offset < s_frame_latency; offset++)
+    {
+        const auto frame = (m_frame_index + offset) % s_frame_latency;
+        if (!m_frames[frame].pending)
+        {
+            continue;
+        }
+
+        if (is_available(frame))
+        {
+            resolve(frame);
+        }
+        else if (frame == m_frame_index)
+        {
+            m_dropped_frames++;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    m_frames[m_frame_index].count = 0;
+    m_frames[m_frame_index].pending = false;
+    m_frames[m_frame_index].frame_scope = false;
+}
+
+bool OpenGLGPUInstrumentor::is_available(const uint32_t frame) const
+{
+    // Results become available in order, so checking the query issued last
+    // is sufficient. That is the end of the frame scope if there is one,
+    // since it is issued in EndFrame, and the end of the last scope
+    // otherwise.
+    const auto& queries = m_frames[frame];
+    const auto scope = queries.frame_scope ? 0 : queries.count - 1;
+    const auto last = get_start_query(frame, scope) + 1;
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(m_queries[last], GL_QUERY_RESULT_AVAILABLE, &available);
+    return available == GL_TRUE;
+}
+
+void OpenGLGPUInstrumentor::resolve(const uint32_t frame)
+{
+    auto& queries = m_frames[frame];
+    for (uint32_t scope = 0; scope < queries.count; scope++)
+    {
+        const auto start_query = get_start_query(frame, scope);
+        GLuint64 start = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(m_queries[start_query], GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(m_queries[start_query + 1],
+            GL_QUERY_RESULT,
+            &end);
+
+        if (scope == 0 && queries.frame_scope)
+        {
+            m_frame_time = static_cast<float>(end - start) / 1000000.0f;
+        }
+
+        ProfileResult result = {};
+        result.Name = queries.names[scope];
+        result.Start = static_cast<int64_t>(start) + m_clock_offset;
+        result.ElapsedTime = static_cast<int64_t>(end - start);
+        result.Track = ProfileTrack::GPU;
+        Instrumentor::Get().WriteProfile(result);
+    }
+    queries.pending = false;
+}
+
+void OpenGLGPUInstrumentor::calibrate()
+{
+    // Maps GPU timestamps onto the clock used for CPU results. The GL
+    // timestamp is taken once all previous commands have reached the GPU, so
+    // the offset is only accurate to within the submission latency.
+    GLint64 gpu_time = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpu_time);
+    m_clock_offset = Instrumentor::Now() - gpu_time;
+}
+
+} // namespace pine
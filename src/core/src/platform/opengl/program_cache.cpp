@@ -0,0 +1,236 @@
+#include "pine/platform/opengl/program_cache.hpp"
+
+#include <fstream>
+
+#include <glad/glad.h>
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+static std::filesystem::path s_program_cache_directory =
+    "resources/cache/shaders";
+
+// Every edit of a shader adds an entry, so the least recently used ones are
+// evicted beyond this count.
+static constexpr size_t s_max_program_cache_entries = 256;
+
+static constexpr uint64_t s_fnv_offset = 14695981039346656037ull;
+static constexpr uint64_t s_fnv_prime = 1099511628211ull;
+
+static uint64_t hash_bytes(uint64_t hash, const std::string_view bytes)
+{
+    for (const auto byte : bytes)
+    {
+        hash ^= static_cast<uint8_t>(byte);
+        hash *= s_fnv_prime;
+    }
+    return hash;
+}
+
+static std::string_view get_driver_string(const GLenum name)
+{
+    const auto string = reinterpret_cast<const char*>(glGetString(name));
+    return string ? string : "";
+}
+
+static void prune_program_cache()
+{
+    using Entry =
+        std::pair<std::filesystem::file_time_type, std::filesystem::path>;
+    std::vector<Entry> entries;
+
+    std::error_code error;
+    auto iterator =
+        std::filesystem::directory_iterator(s_program_cache_directory, error);
+    for (; !error && iterator != std::filesystem::directory_iterator();
+         iterator.increment(error))
+    {
+        std::error_code time_error;
+        const auto time = iterator->last_write_time(time_error);
+        if (!time_error && iterator->path().extension() == ".pbin")
+        {
+            entries.emplace_back(time, iterator->path());
+        }
+    }
+
+    if (entries.size() <= s_max_program_cache_entries)
+    {
+        return;
+    }
+
+    // Loading an entry touches it, so the oldest ones are the least recently
+    // used.
+    std::sort(entries.begin(), entries.end());
+    const auto excess = entries.size() - s_max_program_cache_entries;
+    for (size_t index = 0; index < excess; index++)
+    {
+        std::filesystem::remove(entries[index].second, error);
+    }
+}
+
+void set_program_cache_directory(const std::filesystem::path& directory)
+{
+    s_program_cache_directory = directory;
+}
+
+const std::filesystem::path& get_program_cache_directory()
+{
+    return s_program_cache_directory;
+}
+
+std::filesystem::path get_program_cache_path(const uint64_t key)
+{
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".pbin";
+    return s_program_cache_directory / name.str();
+}
+
+uint64_t get_program_cache_key(
+    const std::unordered_map<uint32_t, std::string>& shader_sources)
+{
+    auto hash = s_fnv_offset;
+    hash = hash_bytes(hash, get_driver_string(GL_VENDOR));
+    hash = hash_bytes(hash, get_driver_string(GL_RENDERER));
+    hash = hash_bytes(hash, get_driver_string(GL_VERSION));
+
+    // The iteration order of the map is unspecified, so hash in stage order.
+    std::vector<uint32_t> types;
+    for (const auto& [type, source] : shader_sources)
+    {
+        types.push_back(type);
+    }
+    std::sort(types.begin(), types.end());
+
+    for (const auto type : types)
+    {
+        hash = hash_bytes(hash,
+            std::string_view(reinterpret_cast<const char*>(&type),
+                sizeof(type)));
+        hash = hash_bytes(hash, shader_sources.at(type));
+    }
+    return hash;
+}
+
+std::optional<RendererID> load_program_binary(const uint64_t key)
+{
+    if (s_program_cache_directory.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto cache_path = get_program_cache_path(key);
+    std::ifstream input_stream(cache_path, std::ios::in | std::ios::binary);
+    if (!input_stream)
+    {
+        return std::nullopt;
+    }
+
+    ProgramCacheHeader header;
+    input_stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!input_stream || header.magic != ProgramCacheHeader::file_magic
+        || header.version != ProgramCacheHeader::file_version
+        || header.key != key)
+    {
+        return std::nullopt;
+    }
+
+    // The size is read from the file, so it is checked before allocating.
+    std::error_code error;
+    const auto file_size = std::filesystem::file_size(cache_path, error);
+    if (error || sizeof(header) + header.binary_size != file_size)
+    {
+        PINE_CORE_WARN("Ignoring corrupt program cache {0}",
+            cache_path.string());
+        return std::nullopt;
+    }
+
+    std::vector<char> binary(header.binary_size);
+    input_stream.read(binary.data(),
+        static_cast<std::streamsize>(binary.size()));
+    if (!input_stream)
+    {
+        return std::nullopt;
+    }
+
+    const auto program = glCreateProgram();
+    glProgramBinary(program,
+        header.binary_format,
+        binary.data(),
+        static_cast<GLsizei>(binary.size()));
+
+    // Drivers reject binaries from other versions, even with the same
+    // version string.
+    auto is_linked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &is_linked);
+    if (is_linked == GL_FALSE)
+    {
+        glDeleteProgram(program);
+        return std::nullopt;
+    }
+
+    std::filesystem::last_write_time(cache_path,
+        std::filesystem::file_time_type::clock::now(),
+        error);
+    return program;
+}
+
+bool write_program_binary(const RendererID program, const uint64_t key)
+{
+    if (s_program_cache_directory.empty())
+    {
+        return false;
+    }
+
+    auto binary_size = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binary_size);
+    if (binary_size <= 0)
+    {
+        return false;
+    }
+
+    ProgramCacheHeader header;
+    header.key = key;
+    std::vector<char> binary(static_cast<size_t>(binary_size));
+    glGetProgramBinary(program,
+        binary_size,
+        &binary_size,
+        &header.binary_format,
+        binary.data());
+    header.binary_size = static_cast<uint32_t>(binary_size);
+
+    std::error_code error;
+    std::filesystem::create_directories(s_program_cache_directory, error);
+
+    // Write to a temporary file first, so that concurrent or interrupted
+    // writes never leave a partial entry behind.
+    const auto cache_path = get_program_cache_path(key);
+    auto temporary_path = cache_path;
+    temporary_path += ".tmp";
+    {
+        std::ofstream output_stream(temporary_path,
+            std::ios::out | std::ios::binary);
+        output_stream.write(reinterpret_cast<const char*>(&header),
+            sizeof(header));
+        output_stream.write(binary.data(),
+            static_cast<std::streamsize>(header.binary_size));
+        if (!output_stream)
+        {
+            PINE_CORE_WARN("Could not write program cache {0}",
+                temporary_path.string());
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporary_path, cache_path, error);
+    if (error)
+    {
+        return false;
+    }
+
+    prune_program_cache();
+    return true;
+}
+
+} // namespace pine
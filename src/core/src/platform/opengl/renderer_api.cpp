@@ -2,22 +2,39 @@
 
 #include <glad/glad.h>
 
+#include "pine/debug/metrics.hpp"
 #include "pine/pch.hpp"
+#include "pine/platform/opengl/state_cache.hpp"
 
 namespace pine
 {
 
+static GLenum to_opengl_primitive(const RendererPrimitives primitive)
+{
+    switch (primitive)
+    {
+    case RendererPrimitives::Points:
+        return GL_POINTS;
+    case RendererPrimitives::Lines:
+        return GL_LINES;
+    case RendererPrimitives::Triangles:
+    case RendererPrimitives::None:
+        return GL_TRIANGLES;
+    }
+    return GL_TRIANGLES;
+}
+
 void OpenGLRendererAPI::init()
 {
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glEnable(GL_DEPTH_TEST);
+    OpenGLStateCache::set_blend(true);
+    OpenGLStateCache::set_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    OpenGLStateCache::set_depth_test(true);
 }
 
 void OpenGLRendererAPI::set_viewport(const uint32_t x, const uint32_t y,
     const uint32_t width, const uint32_t height)
 {
-    glViewport(static_cast<GLint>(x),
+    OpenGLStateCache::set_viewport(static_cast<GLint>(x),
         static_cast<GLint>(y),
         static_cast<GLsizei>(width),
         static_cast<GLsizei>(height));
@@ -25,7 +42,7 @@ void OpenGLRendererAPI::set_viewport(const uint32_t x, const uint32_t y,
 
 void OpenGLRendererAPI::set_clear_color(const Vec4& color)
 {
-    glClearColor(color.r, color.g, color.b, color.a);
+    OpenGLStateCache::set_clear_color(color);
 }
 
 void OpenGLRendererAPI::clear()
@@ -37,12 +54,55 @@ void OpenGLRendererAPI::draw_indexed(const VertexArray& vertex_array,
     const uint32_t index_count)
 {
     const uint32_t count =
-        index_count ? vertex_array.get_index_buffer().get_count() : index_count;
+        index_count ? index_count : vertex_array.get_index_buffer().get_count();
     vertex_array.bind();
     glDrawElements(GL_TRIANGLES,
         static_cast<GLsizei>(count),
         GL_UNSIGNED_INT,
         nullptr);
+
+    Metrics::count(FrameMetric::DRAW_CALLS, 1);
+}
+
+void OpenGLRendererAPI::draw_indexed_indirect(const VertexArray& vertex_array,
+    const IndirectBuffer& indirect_buffer, const uint32_t draw_count,
+    const uint32_t first_draw, const RendererPrimitives primitive)
+{
+    vertex_array.bind();
+    indirect_buffer.bind();
+    glMultiDrawElementsIndirect(to_opengl_primitive(primitive),
+        GL_UNSIGNED_INT,
+        reinterpret_cast<const void*>(
+            first_draw * sizeof(DrawIndexedIndirectCommand)),
+        static_cast<GLsizei>(draw_count),
+        0);
+
+    Metrics::count(FrameMetric::DRAW_CALLS, 1);
+}
+
+void OpenGLRendererAPI::draw_arrays_indirect(const VertexArray& vertex_array,
+    const IndirectBuffer& indirect_buffer, const uint32_t draw_count,
+    const uint32_t first_draw, const RendererPrimitives primitive)
+{
+    vertex_array.bind();
+    indirect_buffer.bind();
+    glMultiDrawArraysIndirect(to_opengl_primitive(primitive),
+        reinterpret_cast<const void*>(
+            first_draw * sizeof(DrawArraysIndirectCommand)),
+        static_cast<GLsizei>(draw_count),
+        0);
+
+    Metrics::count(FrameMetric::DRAW_CALLS, 1);
+}
+
+void OpenGLRendererAPI::dispatch_compute(const uint32_t group_count_x,
+    const uint32_t group_count_y, const uint32_t group_count_z)
+{
+    glDispatchCompute(group_count_x, group_count_y, group_count_z);
+    // Later dispatches and draws may read the results as storage, commands
+    // or vertices.
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT
+        | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
 }
 
 } // namespace pine
@@ -1,46 +1,251 @@
 #include "pine/platform/opengl/shader.hpp"
 
 #include <fstream>
+#include <utility>
 
 #include <glad/glad.h>
 
+#include <GLFW/glfw3.h>
+
+#include "pine/core/job_system.hpp"
+#include "pine/debug/metrics.hpp"
 #include "pine/pch.hpp"
+#include "pine/platform/opengl/program_cache.hpp"
+#include "pine/platform/opengl/state_cache.hpp"
 #include "pine/utils/math.hpp"
 
 namespace pine
 {
 
-static auto to_opengl_shader_type(const std::string& type)
+// Returns zero for unknown types.
+static GLenum to_opengl_shader_type(const std::string& type)
 {
     if (type == "vertex")
         return GL_VERTEX_SHADER;
     if (type == "fragment" || type == "pixel")
         return GL_FRAGMENT_SHADER;
-
-    PINE_CORE_ERROR("Could not convert shader type '{0}'", type);
-    PINE_CORE_ASSERT(false, "Unknown shader type!");
+    if (type == "compute")
+        return GL_COMPUTE_SHADER;
     return 0;
 }
 
+// From GL_KHR_parallel_shader_compile.
+static constexpr GLenum s_completion_status = 0x91B1;
+
+// GL_KHR_parallel_shader_compile and its ARB variant are looked up at
+// runtime, since the loader may not include them. Returns whether the
+// driver compiles in the background.
+static bool enable_parallel_shader_compile()
+{
+    static const auto enabled = []()
+    {
+        using MaxThreadsFunction = void(APIENTRYP)(GLuint);
+
+        auto count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (auto index = 0; index < count; index++)
+        {
+            const std::string_view name = reinterpret_cast<const char*>(
+                glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(index)));
+
+            const char* function_name = nullptr;
+            if (name == "GL_KHR_parallel_shader_compile")
+            {
+                function_name = "glMaxShaderCompilerThreadsKHR";
+            }
+            else if (name == "GL_ARB_parallel_shader_compile")
+            {
+                function_name = "glMaxShaderCompilerThreadsARB";
+            }
+
+            const auto max_threads = function_name
+                ? reinterpret_cast<MaxThreadsFunction>(
+                    glfwGetProcAddress(function_name))
+                : nullptr;
+            if (max_threads)
+            {
+                // Let the driver use as many threads as it wants.
+                max_threads(0xFFFFFFFF);
+                PINE_CORE_INFO("Using {0}", name);
+                return true;
+            }
+        }
+        return false;
+    }();
+    return enabled;
+}
+
+static void copy_uniform_value(const RendererID source,
+    const GLint source_location, const RendererID destination,
+    const GLint destination_location, const GLenum type)
+{
+    std::array<GLfloat, 16> floats = {};
+    std::array<GLint, 4> ints = {};
+    std::array<GLuint, 4> uints = {};
+    switch (type)
+    {
+    case GL_FLOAT:
+        glGetUniformfv(source, source_location, floats.data());
+        glProgramUniform1fv(destination,
+            destination_location,
+            1,
+            floats.data());
+        break;
+    case GL_FLOAT_VEC2:
+        glGetUniformfv(source, source_location, floats.data());
+        glProgramUniform2fv(destination,
+            destination_location,
+            1,
+            floats.data());
+        break;
+    case GL_FLOAT_VEC3:
+        glGetUniformfv(source, source_location, floats.data());
+        glProgramUniform3fv(destination,
+            destination_location,
+            1,
+            floats.data());
+        break;
+    case GL_FLOAT_VEC4:
+        glGetUniformfv(source, source_location, floats.data());
+        glProgramUniform4fv(destination,
+            destination_location,
+            1,
+            floats.data());
+        break;
+    case GL_FLOAT_MAT3:
+        glGetUniformfv(source, source_location, floats.data());
+        glProgramUniformMatrix3fv(destination,
+            destination_location,
+            1,
+            GL_FALSE,
+            floats.data());
+        break;
+    case GL_FLOAT_MAT4:
+        glGetUniformfv(source, source_location, floats.data());
+        glProgramUniformMatrix4fv(destination,
+            destination_location,
+            1,
+            GL_FALSE,
+            floats.data());
+        break;
+    case GL_INT:
+    case GL_BOOL:
+    case GL_SAMPLER_2D:
+    case GL_SAMPLER_2D_ARRAY:
+    case GL_SAMPLER_2D_MULTISAMPLE:
+    case GL_SAMPLER_CUBE:
+    case GL_INT_SAMPLER_2D:
+    case GL_UNSIGNED_INT_SAMPLER_2D:
+    case GL_IMAGE_2D:
+        // Samplers and images hold the texture unit.
+        glGetUniformiv(source, source_location, ints.data());
+        glProgramUniform1iv(destination, destination_location, 1, ints.data());
+        break;
+    case GL_INT_VEC2:
+        glGetUniformiv(source, source_location, ints.data());
+        glProgramUniform2iv(destination, destination_location, 1, ints.data());
+        break;
+    case GL_UNSIGNED_INT:
+        glGetUniformuiv(source, source_location, uints.data());
+        glProgramUniform1uiv(destination,
+            destination_location,
+            1,
+            uints.data());
+        break;
+    default:
+        break;
+    }
+}
+
+// Carries the uniform values over to a reloaded program, so that values
+// which are only set once, like the sampler slots, survive the reload.
+static void copy_uniform_values(const RendererID source,
+    const RendererID destination)
+{
+    auto uniform_count = 0;
+    auto max_length = 0;
+    glGetProgramiv(source, GL_ACTIVE_UNIFORMS, &uniform_count);
+    glGetProgramiv(source, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+
+    std::vector<GLchar> name_buffer(static_cast<size_t>(max_length) + 1);
+    for (auto index = 0; index < uniform_count; index++)
+    {
+        auto length = 0;
+        auto size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(source,
+            static_cast<GLuint>(index),
+            static_cast<GLsizei>(name_buffer.size()),
+            &length,
+            &size,
+            &type,
+            name_buffer.data());
+
+        // Arrays are listed once, by the name of their first element.
+        auto name = std::string(name_buffer.data(),
+            static_cast<size_t>(length));
+        if (size > 1 && name.size() > 3
+            && name.compare(name.size() - 3, 3, "[0]") == 0)
+        {
+            name.resize(name.size() - 3);
+        }
+
+        for (auto element = 0; element < size; element++)
+        {
+            const auto element_name = size > 1
+                ? name + "[" + std::to_string(element) + "]"
+                : name;
+            const auto source_location =
+                glGetUniformLocation(source, element_name.c_str());
+            const auto destination_location =
+                glGetUniformLocation(destination, element_name.c_str());
+            // Members of uniform blocks have no location.
+            if (source_location >= 0 && destination_location >= 0)
+            {
+                copy_uniform_value(source,
+                    source_location,
+                    destination,
+                    destination_location,
+                    type);
+            }
+        }
+    }
+}
+
 OpenGLShader::OpenGLShader(const std::filesystem::path& filepath)
 {
+    OpenGLStateCache::assert_context_thread();
     const auto source = read_file(filepath);
     const auto shader_sources = preprocess(source);
+    PINE_CORE_ASSERT(!shader_sources.empty(),
+        "Shader preprocessing failure!");
     compile_shader(shader_sources);
     m_name = filepath.stem();
+    m_filepath = filepath;
 }
 
 OpenGLShader::OpenGLShader(const std::string& name,
     const std::string& vertex_source, const std::string& fragment_source)
     : m_name(name)
 {
+    OpenGLStateCache::assert_context_thread();
     std::unordered_map<GLenum, std::string> shader_sources;
     shader_sources[GL_VERTEX_SHADER] = vertex_source;
     shader_sources[GL_FRAGMENT_SHADER] = fragment_source;
     compile_shader(shader_sources);
 }
 
-OpenGLShader::~OpenGLShader() { glDeleteProgram(m_renderer_id); }
+OpenGLShader::~OpenGLShader()
+{
+    // A shader may be destroyed while it is still compiling, e.g. a reload
+    // that is replaced by newer sources.
+    for (const auto shader : m_pending_shaders)
+    {
+        glDeleteShader(shader);
+    }
+    glDeleteProgram(m_renderer_id);
+    OpenGLStateCache::forget_program(m_renderer_id);
+}
 
 std::string OpenGLShader::read_file(const std::filesystem::path& filepath)
 {
@@ -67,28 +272,40 @@ std::unordered_map<GLenum, std::string> OpenGLShader::preprocess(
 {
     std::unordered_map<GLenum, std::string> shader_sources;
 
-    // TODO: Refine and clean up!
     constexpr auto type_token = "#type";
     const auto type_token_length = strlen(type_token);
     auto pos = source.find(type_token, 0);
     while (pos != std::string::npos)
     {
         const auto eol = source.find_first_of("\r\n", pos);
-        PINE_CORE_ASSERT(eol != std::string::npos,
-            "Syntax error in shader preprocessing!");
+        const auto next_line_pos = eol == std::string::npos
+            ? std::string::npos
+            : source.find_first_not_of("\r\n", eol);
+        if (next_line_pos == std::string::npos)
+        {
+            PINE_CORE_ERROR("Shader stage without source.");
+            return {};
+        }
+
         const auto begin = pos + type_token_length + 1;
         const auto type = source.substr(begin, eol - begin);
-        PINE_CORE_ASSERT(to_opengl_shader_type(type),
-            "Invalid shader type specified!");
+        const auto shader_type = to_opengl_shader_type(type);
+        if (!shader_type)
+        {
+            PINE_CORE_ERROR("Invalid shader type '{0}'.", type);
+            return {};
+        }
 
-        const auto next_line_pos = source.find_first_not_of("\r\n", eol);
         pos = source.find(type_token, next_line_pos);
+        shader_sources[shader_type] =
+            source.substr(next_line_pos, pos - next_line_pos);
+    }
 
-        const auto entry_size = next_line_pos == std::string::npos
-            ? source.size() - 1
-            : next_line_pos;
-        shader_sources[static_cast<uint32_t>(to_opengl_shader_type(type))] =
-            source.substr(next_line_pos, pos - entry_size);
+    if (shader_sources.empty() || shader_sources.size() > 2)
+    {
+        PINE_CORE_ERROR("Shaders must have one or two stages, not {0}.",
+            shader_sources.size());
+        return {};
     }
 
     return shader_sources;
@@ -97,20 +314,78 @@ std::unordered_map<GLenum, std::string> OpenGLShader::preprocess(
 void OpenGLShader::compile_shader(
     const std::unordered_map<GLenum, std::string>& shader_sources)
 {
-    const auto program = glCreateProgram();
+    begin_compile(shader_sources);
+    if (!finish_compile())
+    {
+        PINE_CORE_ASSERT(false, "Shader compilation failure!");
+    }
+}
+
+void OpenGLShader::begin_compile(
+    const std::unordered_map<GLenum, std::string>& shader_sources)
+{
+    m_cache_key = get_program_cache_key(shader_sources);
+    if (const auto cached_program = load_program_binary(m_cache_key))
+    {
+        m_renderer_id = *cached_program;
+        return;
+    }
+
     PINE_CORE_ASSERT(shader_sources.size() <= 2,
         "pine only supports 2 shaders for now.");
-    std::array<GLenum, 2> shader_ids;
-    auto shader_id_index = 0;
-    for (auto& source : shader_sources)
-    {
-        const auto& source_type = source.first;
-        const auto source_string = source.second.c_str();
-        const auto shader = glCreateShader(source_type);
 
-        glShaderSource(shader, 1, &source_string, 0);
+    // The status is queried in finish_compile, so that the driver may compile
+    // and link in the background meanwhile.
+    m_renderer_id = glCreateProgram();
+    glProgramParameteri(m_renderer_id,
+        GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+        GL_TRUE);
+    for (const auto& [type, source] : shader_sources)
+    {
+        const auto source_string = source.c_str();
+        const auto shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source_string, nullptr);
         glCompileShader(shader);
+        glAttachShader(m_renderer_id, shader);
+        m_pending_shaders.push_back(shader);
+    }
+    glLinkProgram(m_renderer_id);
+}
+
+bool OpenGLShader::is_compile_complete() const
+{
+    if (m_pending_shaders.empty() || !enable_parallel_shader_compile())
+    {
+        return true;
+    }
+
+    // Does not wait for the driver, unlike the link status.
+    auto is_complete = 0;
+    glGetProgramiv(m_renderer_id, s_completion_status, &is_complete);
+    return is_complete != GL_FALSE;
+}
+
+bool OpenGLShader::finish_compile()
+{
+    if (m_pending_shaders.empty())
+    {
+        return m_renderer_id != 0;
+    }
 
+    const auto discard_program = [this]()
+    {
+        glDeleteProgram(m_renderer_id);
+        m_renderer_id = 0;
+
+        for (const auto shader : m_pending_shaders)
+        {
+            glDeleteShader(shader);
+        }
+        m_pending_shaders.clear();
+    };
+
+    for (const auto shader : m_pending_shaders)
+    {
         auto is_compiled = 0;
         glGetShaderiv(shader, GL_COMPILE_STATUS, &is_compiled);
         if (is_compiled == GL_FALSE)
@@ -121,56 +396,169 @@ void OpenGLShader::compile_shader(
             std::vector<GLchar> info_log(static_cast<uint32_t>(max_length));
             glGetShaderInfoLog(shader, max_length, &max_length, &info_log[0]);
 
-            glDeleteShader(shader);
-
             // TODO: Add shader type logging.
-            PINE_CORE_ERROR("{0}", info_log.data());
-            PINE_CORE_ASSERT(false, "Shader compilation failure!")
-            break;
+            PINE_CORE_ERROR("{0}: {1}", m_name, info_log.data());
+            discard_program();
+            return false;
         }
-
-        glAttachShader(program, shader);
-        shader_ids[static_cast<uint32_t>(shader_id_index++)] = shader;
     }
 
-    glLinkProgram(program);
-
     auto is_linked = 0;
-    // NOTE: Was const_cast<int*>(&is_linked)
-    glGetProgramiv(program, GL_LINK_STATUS, &is_linked);
+    glGetProgramiv(m_renderer_id, GL_LINK_STATUS, &is_linked);
     if (is_linked == GL_FALSE)
     {
         auto max_length = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &max_length);
+        glGetProgramiv(m_renderer_id, GL_INFO_LOG_LENGTH, &max_length);
 
         // The max_length includes the NULL character
         std::vector<GLchar> info_log(static_cast<uint32_t>(max_length));
-        glGetProgramInfoLog(program, max_length, &max_length, &info_log[0]);
+        glGetProgramInfoLog(m_renderer_id,
+            max_length,
+            &max_length,
+            &info_log[0]);
+
+        PINE_CORE_ERROR("{0}: {1}", m_name, info_log.data());
+        discard_program();
+        return false;
+    }
 
-        // We don't need the program anymore.
-        glDeleteProgram(program);
+    for (const auto shader : m_pending_shaders)
+    {
+        glDetachShader(m_renderer_id, shader);
+        glDeleteShader(shader);
+    }
+    m_pending_shaders.clear();
 
-        for (auto id : shader_ids)
-        {
-            glDeleteShader(id);
-        }
+    write_program_binary(m_renderer_id, m_cache_key);
+    return true;
+}
 
-        PINE_CORE_ERROR("{0}", info_log.data());
-        PINE_CORE_ASSERT(false, "Shader link failure!");
+void OpenGLShader::reload_source()
+{
+    if (m_filepath.empty())
+    {
         return;
     }
 
-    for (auto id : shader_ids)
+    // The file may be saved half edited, which must not stop the program.
+    auto shader_sources = preprocess(read_file(m_filepath));
+    if (shader_sources.empty())
     {
-        glDetachShader(program, id);
+        PINE_CORE_ERROR("Reloading shader {0} failed, keeping the current "
+                        "program.",
+            m_name);
+        return;
     }
 
-    m_renderer_id = program;
+    std::scoped_lock lock(m_reload_mutex);
+    m_reload_sources = std::move(shader_sources);
+    m_reloading = true;
 }
 
-void OpenGLShader::bind() const { glUseProgram(m_renderer_id); }
+void OpenGLShader::update_reload()
+{
+    if (!m_reloading)
+    {
+        return;
+    }
+
+    std::scoped_lock lock(m_reload_mutex);
+    if (m_reload_sources)
+    {
+        // Newer sources replace a compile that is still in flight. Unchanged
+        // sources are loaded from the program cache.
+        m_reload_shader = std::unique_ptr<OpenGLShader>(new OpenGLShader());
+        m_reload_shader->m_name = m_name;
+        m_reload_shader->begin_compile(*m_reload_sources);
+        m_reload_sources.reset();
+    }
+
+    if (m_reload_shader && !m_reload_shader->is_compile_complete())
+    {
+        return;
+    }
+
+    const auto shader = std::move(m_reload_shader);
+    m_reloading = false;
+    if (!shader || !shader->finish_compile())
+    {
+        PINE_CORE_ERROR("Reloading shader {0} failed, keeping the current "
+                        "program.",
+            m_name);
+        return;
+    }
+
+    copy_uniform_values(m_renderer_id, shader->m_renderer_id);
+    glDeleteProgram(m_renderer_id);
+    OpenGLStateCache::forget_program(m_renderer_id);
+
+    m_renderer_id = std::exchange(shader->m_renderer_id, 0);
+    m_cache_key = shader->m_cache_key;
+    m_uniform_locations.clear();
+    m_uniform_values.clear();
+    PINE_CORE_INFO("Reloaded shader {0}.", m_name);
+}
+
+std::vector<std::unique_ptr<Shader>> OpenGLShader::create_batch(
+    const std::vector<std::filesystem::path>& filepaths,
+    JobSystem* job_system)
+{
+    OpenGLStateCache::assert_context_thread();
+    enable_parallel_shader_compile();
+
+    // Reading and preprocessing does not need the context.
+    const auto count = static_cast<uint32_t>(filepaths.size());
+    std::vector<std::unordered_map<GLenum, std::string>> sources(count);
+    const auto load = [&filepaths, &sources](const uint32_t index)
+    { sources[index] = preprocess(read_file(filepaths[index])); };
+    if (job_system)
+    {
+        job_system->parallel_for(0, count, 1, load);
+    }
+    else
+    {
+        for (uint32_t index = 0; index < count; index++)
+        {
+            load(index);
+        }
+    }
+
+    // Issue all compiles and links before the first status query.
+    std::vector<std::unique_ptr<OpenGLShader>> compiling(count);
+    for (uint32_t index = 0; index < count; index++)
+    {
+        if (sources[index].empty())
+        {
+            PINE_CORE_ERROR("Could not load shader {0}.",
+                filepaths[index].string());
+            continue;
+        }
+
+        auto shader = std::unique_ptr<OpenGLShader>(new OpenGLShader());
+        shader->m_name = filepaths[index].stem();
+        shader->m_filepath = filepaths[index];
+        shader->begin_compile(sources[index]);
+        compiling[index] = std::move(shader);
+    }
+
+    std::vector<std::unique_ptr<Shader>> shaders;
+    for (auto& shader : compiling)
+    {
+        if (shader && !shader->finish_compile())
+        {
+            shader.reset();
+        }
+        shaders.push_back(std::move(shader));
+    }
+    return shaders;
+}
+
+void OpenGLShader::bind() const
+{
+    OpenGLStateCache::use_program(m_renderer_id);
+}
 
-void OpenGLShader::unbind() const { glUseProgram(0); }
+void OpenGLShader::unbind() const { OpenGLStateCache::use_program(0); }
 
 void OpenGLShader::set_int(const std::string& name, const int value) const
 {
@@ -206,57 +594,136 @@ void OpenGLShader::set_mat4(const std::string& name, const Mat4& value) const
 void OpenGLShader::upload_uniform_int(const std::string& name,
     const int value) const
 {
-    const auto location = glGetUniformLocation(m_renderer_id, name.c_str());
-    glUniform1i(location, value);
+    const auto location = get_uniform_location(name);
+    if (update_uniform_value(location, &value, sizeof(value)))
+    {
+        glProgramUniform1i(m_renderer_id, location, value);
+    }
 }
 
 void OpenGLShader::upload_uniform_int_array(const std::string& name,
     const int* values, const uint32_t count) const
 {
-    const auto location = glGetUniformLocation(m_renderer_id, name.c_str());
-    glUniform1iv(location, static_cast<GLsizei>(count), values);
+    const auto location = get_uniform_location(name);
+    if (update_uniform_value(location, values, count * sizeof(int)))
+    {
+        glProgramUniform1iv(m_renderer_id,
+            location,
+            static_cast<GLsizei>(count),
+            values);
+    }
 }
 
 void OpenGLShader::upload_uniform_float(const std::string& name,
     const float value) const
 {
-    const auto location = glGetUniformLocation(m_renderer_id, name.c_str());
-    glUniform1f(location, value);
+    const auto location = get_uniform_location(name);
+    if (update_uniform_value(location, &value, sizeof(value)))
+    {
+        glProgramUniform1f(m_renderer_id, location, value);
+    }
 }
 
 void OpenGLShader::upload_uniform_float2(const std::string& name,
     const Vec2& values) const
 {
-    const auto location = glGetUniformLocation(m_renderer_id, name.c_str());
-    glUniform2f(location, values.x, values.y);
+    const auto location = get_uniform_location(name);
+    if (update_uniform_value(location, &values, sizeof(values)))
+    {
+        glProgramUniform2f(m_renderer_id, location, values.x, values.y);
+    }
 }
 
 void OpenGLShader::upload_uniform_float3(const std::string& name,
     const Vec3& values) const
 {
-    const auto location = glGetUniformLocation(m_renderer_id, name.c_str());
-    glUniform3f(location, values.x, values.y, values.z);
+    const auto location = get_uniform_location(name);
+    if (update_uniform_value(location, &values, sizeof(values)))
+    {
+        glProgramUniform3f(m_renderer_id,
+            location,
+            values.x,
+            values.y,
+            values.z);
+    }
 }
 
 void OpenGLShader::upload_uniform_float4(const std::string& name,
     const Vec4& values) const
 {
-    const auto location = glGetUniformLocation(m_renderer_id, name.c_str());
-    glUniform4f(location, values.x, values.y, values.z, values.w);
+    const auto location = get_uniform_location(name);
+    if (update_uniform_value(location, &values, sizeof(values)))
+    {
+        glProgramUniform4f(m_renderer_id,
+            location,
+            values.x,
+            values.y,
+            values.z,
+            values.w);
+    }
 }
 
 void OpenGLShader::upload_uniform_mat3(const std::string& name,
     const Mat3& matrix) const
 {
-    const auto location = glGetUniformLocation(m_renderer_id, name.c_str());
-    glUniformMatrix3fv(location, 1, GL_FALSE, value_ptr(matrix));
+    const auto location = get_uniform_location(name);
+    if (update_uniform_value(location, &matrix, sizeof(matrix)))
+    {
+        glProgramUniformMatrix3fv(m_renderer_id,
+            location,
+            1,
+            GL_FALSE,
+            value_ptr(matrix));
+    }
 }
 
 void OpenGLShader::upload_uniform_mat4(const std::string& name,
     const Mat4& matrix) const
 {
+    const auto location = get_uniform_location(name);
+    if (update_uniform_value(location, &matrix, sizeof(matrix)))
+    {
+        glProgramUniformMatrix4fv(m_renderer_id,
+            location,
+            1,
+            GL_FALSE,
+            value_ptr(matrix));
+    }
+}
+
+int OpenGLShader::get_uniform_location(const std::string& name) const
+{
+    OpenGLStateCache::assert_context_thread();
+    const auto it = m_uniform_locations.find(name);
+    if (it != m_uniform_locations.end())
+    {
+        return it->second;
+    }
+
     const auto location = glGetUniformLocation(m_renderer_id, name.c_str());
-    glUniformMatrix4fv(location, 1, GL_FALSE, value_ptr(matrix));
+    m_uniform_locations.emplace(name, location);
+    return location;
+}
+
+bool OpenGLShader::update_uniform_value(const int location, const void* data,
+    const size_t size) const
+{
+    if (location < 0)
+    {
+        return false;
+    }
+
+    const auto bytes = static_cast<const uint8_t*>(data);
+    auto& value = m_uniform_values[location];
+    if (value.size() == size && std::equal(value.begin(), value.end(), bytes))
+    {
+        Metrics::count(FrameMetric::REDUNDANT_STATE_CHANGES, 1);
+        return false;
+    }
+
+    value.assign(bytes, bytes + size);
+    Metrics::count(FrameMetric::STATE_CHANGES, 1);
+    return true;
 }
 
 } // namespace pine
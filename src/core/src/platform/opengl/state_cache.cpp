@@ -0,0 +1,205 @@
+#include "pine/platform/opengl/state_cache.hpp"
+
+#include <glad/glad.h>
+
+#include "pine/debug/metrics.hpp"
+#include "pine/pch.hpp"
+#include "pine/renderer/render_command.hpp"
+
+namespace pine
+{
+
+OpenGLStateCache::State OpenGLStateCache::s_state = {};
+
+template <typename T>
+bool OpenGLStateCache::update(T& current, const T& value)
+{
+    assert_context_thread();
+    if (current == value)
+    {
+        Metrics::count(FrameMetric::REDUNDANT_STATE_CHANGES, 1);
+        return false;
+    }
+    current = value;
+    Metrics::count(FrameMetric::STATE_CHANGES, 1);
+    return true;
+}
+
+void OpenGLStateCache::assert_context_thread()
+{
+    PINE_CORE_ASSERT(!RenderCommand::is_recording(),
+        "Graphics calls must be enqueued while a render thread runs.");
+}
+
+void OpenGLStateCache::invalidate()
+{
+    s_state = {};
+    s_state.buffers = {BufferBinding{GL_ARRAY_BUFFER, s_unknown},
+        BufferBinding{GL_PIXEL_UNPACK_BUFFER, s_unknown},
+        BufferBinding{GL_UNIFORM_BUFFER, s_unknown},
+        BufferBinding{GL_SHADER_STORAGE_BUFFER, s_unknown},
+        BufferBinding{GL_DRAW_INDIRECT_BUFFER, s_unknown}};
+    s_state.textures.fill(s_unknown);
+    s_state.viewport.fill(-1);
+    s_state.blend_func.fill(s_unknown);
+}
+
+void OpenGLStateCache::use_program(const RendererID program)
+{
+    if (update(s_state.program, program))
+    {
+        glUseProgram(program);
+    }
+}
+
+void OpenGLStateCache::bind_vertex_array(const RendererID vertex_array)
+{
+    if (update(s_state.vertex_array, vertex_array))
+    {
+        glBindVertexArray(vertex_array);
+    }
+}
+
+void OpenGLStateCache::bind_buffer(const uint32_t target,
+    const RendererID buffer)
+{
+    for (auto& binding : s_state.buffers)
+    {
+        if (binding.target == target)
+        {
+            if (update(binding.buffer, buffer))
+            {
+                glBindBuffer(target, buffer);
+            }
+            return;
+        }
+    }
+    glBindBuffer(target, buffer);
+}
+
+void OpenGLStateCache::bind_buffer_base(const uint32_t target,
+    const uint32_t index, const RendererID buffer)
+{
+    OpenGLStateCache::assert_context_thread();
+    glBindBufferBase(target, index, buffer);
+    Metrics::count(FrameMetric::STATE_CHANGES, 1);
+    for (auto& binding : s_state.buffers)
+    {
+        if (binding.target == target)
+        {
+            binding.buffer = buffer;
+        }
+    }
+}
+
+void OpenGLStateCache::bind_texture_unit(const uint32_t unit,
+    const RendererID texture)
+{
+    if (unit >= s_texture_unit_count || update(s_state.textures[unit], texture))
+    {
+        glBindTextureUnit(unit, texture);
+    }
+}
+
+void OpenGLStateCache::bind_framebuffer(const RendererID framebuffer)
+{
+    if (update(s_state.framebuffer, framebuffer))
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    }
+}
+
+void OpenGLStateCache::set_viewport(const int32_t x, const int32_t y,
+    const int32_t width, const int32_t height)
+{
+    if (update(s_state.viewport, {x, y, width, height}))
+    {
+        glViewport(x, y, width, height);
+    }
+}
+
+void OpenGLStateCache::set_blend(const bool enabled)
+{
+    if (update(s_state.blend, static_cast<int8_t>(enabled)))
+    {
+        enabled ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+    }
+}
+
+void OpenGLStateCache::set_blend_func(const uint32_t source,
+    const uint32_t destination)
+{
+    if (update(s_state.blend_func, {source, destination}))
+    {
+        glBlendFunc(source, destination);
+    }
+}
+
+void OpenGLStateCache::set_depth_test(const bool enabled)
+{
+    if (update(s_state.depth_test, static_cast<int8_t>(enabled)))
+    {
+        enabled ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+    }
+}
+
+void OpenGLStateCache::set_clear_color(const Vec4& color)
+{
+    if (update(s_state.clear_color, color))
+    {
+        glClearColor(color.r, color.g, color.b, color.a);
+    }
+}
+
+void OpenGLStateCache::forget_program(const RendererID program)
+{
+    OpenGLStateCache::assert_context_thread();
+    if (s_state.program == program)
+    {
+        s_state.program = s_unknown;
+    }
+}
+
+void OpenGLStateCache::forget_vertex_array(const RendererID vertex_array)
+{
+    OpenGLStateCache::assert_context_thread();
+    if (s_state.vertex_array == vertex_array)
+    {
+        s_state.vertex_array = s_unknown;
+    }
+}
+
+void OpenGLStateCache::forget_buffer(const RendererID buffer)
+{
+    OpenGLStateCache::assert_context_thread();
+    for (auto& binding : s_state.buffers)
+    {
+        if (binding.buffer == buffer)
+        {
+            binding.buffer = s_unknown;
+        }
+    }
+}
+
+void OpenGLStateCache::forget_texture(const RendererID texture)
+{
+    OpenGLStateCache::assert_context_thread();
+    for (auto& binding : s_state.textures)
+    {
+        if (binding == texture)
+        {
+            binding = s_unknown;
+        }
+    }
+}
+
+void OpenGLStateCache::forget_framebuffer(const RendererID framebuffer)
+{
+    OpenGLStateCache::assert_context_thread();
+    if (s_state.framebuffer == framebuffer)
+    {
+        s_state.framebuffer = s_unknown;
+    }
+}
+
+} // namespace pine
@@ -3,12 +3,21 @@
 
 #include <filesystem>
 #include <fstream>
+#include <utility>
 
 #include <glad/glad.h>
 
+#include "pine/debug/memory_tracker.hpp"
+#include "pine/debug/metrics.hpp"
+#include "pine/platform/opengl/state_cache.hpp"
+
 namespace pine
 {
 
+// S3TC formats from EXT_texture_compression_s3tc.
+static constexpr GLenum s_compressed_rgb_s3tc_dxt1 = 0x83F0;
+static constexpr GLenum s_compressed_rgba_s3tc_dxt5 = 0x83F3;
+
 GLenum to_opengl_internal_format(const ImageFormat& image_format)
 {
     const auto texture_format = static_cast<TextureFormat>(image_format);
@@ -73,9 +82,12 @@ OpenGLTexture2D::OpenGLTexture2D(const std::filesystem::path& image_path)
     m_source = image_path;
 }
 
-OpenGLTexture2D::OpenGLTexture2D(const Image& image)
-    : m_source(""), m_width(image.get_width()), m_height(image.get_height())
+OpenGLTexture2D::OpenGLTexture2D(const Image& image,
+    const TextureFilter filter)
+    : m_source(""), m_width(image.get_width()), m_height(image.get_height()),
+      m_filter(filter)
 {
+    OpenGLStateCache::assert_context_thread();
     glCreateTextures(GL_TEXTURE_2D, 1, &m_renderer_id);
 
     glTextureStorage2D(m_renderer_id,
@@ -85,10 +97,14 @@ OpenGLTexture2D::OpenGLTexture2D(const Image& image)
         static_cast<GLsizei>(image.get_height()));
 
     glTextureParameteri(m_renderer_id, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTextureParameteri(m_renderer_id, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureParameteri(m_renderer_id,
+        GL_TEXTURE_MAG_FILTER,
+        filter == TextureFilter::LINEAR ? GL_LINEAR : GL_NEAREST);
     glTextureParameteri(m_renderer_id, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTextureParameteri(m_renderer_id, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
+    // Rows of single channel images are not aligned to four bytes.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     glTextureSubImage2D(m_renderer_id,
         0,
         0,
@@ -98,16 +114,131 @@ OpenGLTexture2D::OpenGLTexture2D(const Image& image)
         to_opengl_data_format(image.get_format()),
         GL_UNSIGNED_BYTE,
         static_cast<const void*>(image.get_buffer().data()));
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, image.get_buffer().size());
+
+    m_memory_size = image.get_buffer().size();
+    PINE_TRACK_ALLOCATION(MemoryTag::TEXTURE, m_memory_size);
+}
+
+OpenGLTexture2D::OpenGLTexture2D(const MappedTextureFile& file,
+    const std::filesystem::path& source_path)
+    : m_source(source_path), m_width(file.get_header().width),
+      m_height(file.get_header().height)
+{
+    OpenGLStateCache::assert_context_thread();
+    const auto& header = file.get_header();
+    const auto image_format = static_cast<ImageFormat>(header.format);
+    const auto internal_format = [&header, image_format]()
+    {
+        switch (header.compression)
+        {
+        case TextureCompression::NONE:
+            return to_opengl_internal_format(image_format);
+        case TextureCompression::BC1:
+            return s_compressed_rgb_s3tc_dxt1;
+        case TextureCompression::BC3:
+            return s_compressed_rgba_s3tc_dxt5;
+        }
+        return to_opengl_internal_format(image_format);
+    }();
+
+    glCreateTextures(GL_TEXTURE_2D, 1, &m_renderer_id);
+    glTextureStorage2D(m_renderer_id,
+        static_cast<GLsizei>(header.mip_count),
+        internal_format,
+        static_cast<GLsizei>(header.width),
+        static_cast<GLsizei>(header.height));
+
+    glTextureParameteri(m_renderer_id,
+        GL_TEXTURE_MIN_FILTER,
+        header.mip_count > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTextureParameteri(m_renderer_id, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureParameteri(m_renderer_id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTextureParameteri(m_renderer_id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    // Stage every mip level from the mapped file in one pixel unpack buffer,
+    // then source the texture uploads from buffer offsets.
+    RendererID pixel_buffer = 0;
+    glCreateBuffers(1, &pixel_buffer);
+    glNamedBufferStorage(pixel_buffer,
+        static_cast<GLsizeiptr>(file.get_data_size()),
+        file.get_data(),
+        0);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, file.get_data_size());
+
+    OpenGLStateCache::bind_buffer(GL_PIXEL_UNPACK_BUFFER, pixel_buffer);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    const auto base_offset = file.get_mip(0).offset;
+    for (uint32_t level = 0; level < header.mip_count; level++)
+    {
+        const auto& mip = file.get_mip(level);
+        const auto offset =
+            reinterpret_cast<const void*>(mip.offset - base_offset);
+
+        if (header.compression == TextureCompression::NONE)
+        {
+            glTextureSubImage2D(m_renderer_id,
+                static_cast<GLint>(level),
+                0,
+                0,
+                static_cast<GLsizei>(mip.width),
+                static_cast<GLsizei>(mip.height),
+                to_opengl_data_format(image_format),
+                GL_UNSIGNED_BYTE,
+                offset);
+        }
+        else
+        {
+            glCompressedTextureSubImage2D(m_renderer_id,
+                static_cast<GLint>(level),
+                0,
+                0,
+                static_cast<GLsizei>(mip.width),
+                static_cast<GLsizei>(mip.height),
+                internal_format,
+                static_cast<GLsizei>(mip.size),
+                offset);
+        }
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    OpenGLStateCache::bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &pixel_buffer);
+
+    m_memory_size = file.get_data_size();
+    PINE_TRACK_ALLOCATION(MemoryTag::TEXTURE, m_memory_size);
 }
 
-OpenGLTexture2D::~OpenGLTexture2D() { glDeleteTextures(1, &m_renderer_id); }
+OpenGLTexture2D::~OpenGLTexture2D()
+{
+    glDeleteTextures(1, &m_renderer_id);
+    OpenGLStateCache::forget_texture(m_renderer_id);
+    PINE_TRACK_DEALLOCATION(MemoryTag::TEXTURE, m_memory_size);
+}
 
 void OpenGLTexture2D::bind(const uint32_t slot) const
 {
-    glBindTextureUnit(slot, m_renderer_id);
+    OpenGLStateCache::bind_texture_unit(slot, m_renderer_id);
+}
+
+void OpenGLTexture2D::unbind() const
+{
+    OpenGLStateCache::bind_texture_unit(0, 0);
 }
 
-void OpenGLTexture2D::unbind() const { glBindTexture(GL_TEXTURE_2D, 0); }
+void OpenGLTexture2D::set_image(const Image& image)
+{
+    OpenGLStateCache::assert_context_thread();
+    // The new texture is created first, and the old one is deleted with the
+    // temporary.
+    OpenGLTexture2D texture(image, m_filter);
+    std::swap(m_renderer_id, texture.m_renderer_id);
+    std::swap(m_width, texture.m_width);
+    std::swap(m_height, texture.m_height);
+    std::swap(m_memory_size, texture.m_memory_size);
+}
 
 bool OpenGLTexture2D::operator==(const Texture& other) const
 {
@@ -115,4 +246,66 @@ bool OpenGLTexture2D::operator==(const Texture& other) const
         == reinterpret_cast<const OpenGLTexture2D&>(other).m_renderer_id;
 }
 
+OpenGLIndexTexture2D::OpenGLIndexTexture2D(const uint32_t width,
+    const uint32_t height)
+    : m_width(width), m_height(height)
+{
+    OpenGLStateCache::assert_context_thread();
+    glCreateTextures(GL_TEXTURE_2D, 1, &m_renderer_id);
+    glTextureStorage2D(m_renderer_id,
+        1,
+        GL_R16UI,
+        static_cast<GLsizei>(width),
+        static_cast<GLsizei>(height));
+
+    // Integer textures are incomplete with linear filtering.
+    glTextureParameteri(m_renderer_id, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTextureParameteri(m_renderer_id, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureParameteri(m_renderer_id, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(m_renderer_id, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    m_memory_size = uint64_t{width} * height * sizeof(uint16_t);
+    PINE_TRACK_ALLOCATION(MemoryTag::TEXTURE, m_memory_size);
+}
+
+OpenGLIndexTexture2D::~OpenGLIndexTexture2D()
+{
+    glDeleteTextures(1, &m_renderer_id);
+    OpenGLStateCache::forget_texture(m_renderer_id);
+    PINE_TRACK_DEALLOCATION(MemoryTag::TEXTURE, m_memory_size);
+}
+
+void OpenGLIndexTexture2D::bind(const uint32_t slot) const
+{
+    OpenGLStateCache::bind_texture_unit(slot, m_renderer_id);
+}
+
+void OpenGLIndexTexture2D::unbind() const
+{
+    OpenGLStateCache::bind_texture_unit(0, 0);
+}
+
+void OpenGLIndexTexture2D::set_data(const uint16_t* indices)
+{
+    OpenGLStateCache::assert_context_thread();
+    // Rows of odd widths are not aligned to four bytes.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+    glTextureSubImage2D(m_renderer_id,
+        0,
+        0,
+        0,
+        static_cast<GLsizei>(m_width),
+        static_cast<GLsizei>(m_height),
+        GL_RED_INTEGER,
+        GL_UNSIGNED_SHORT,
+        static_cast<const void*>(indices));
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    Metrics::count(FrameMetric::UPLOADED_BYTES, m_memory_size);
+}
+
+bool OpenGLIndexTexture2D::operator==(const Texture& other) const
+{
+    return m_renderer_id == other.get_renderer_id();
+}
+
 } // namespace pine
@@ -67,24 +67,21 @@ void WindowsWindow::Init()
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
             data.width = width;
             data.height = height;
-            WindowResizeEvent event(width, height);
-            data.event_callback(event);
+            data.event_queue.push<WindowResizeEvent>(width, height);
         });
 
     glfwSetWindowIconifyCallback(m_window,
         [](GLFWwindow* window, int iconified)
         {
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-            WindowIconifyEvent event(iconified == 1);
-            data.event_callback(event);
+            data.event_queue.push<WindowIconifyEvent>(iconified == 1);
         });
 
     glfwSetWindowCloseCallback(m_window,
         [](GLFWwindow* window)
         {
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-            WindowCloseEvent event;
-            data.event_callback(event);
+            data.event_queue.push<WindowCloseEvent>();
         });
 
     glfwSetKeyCallback(m_window,
@@ -95,20 +92,22 @@ void WindowsWindow::Init()
             {
             case GLFW_PRESS:
             {
-                KeyPressedEvent event(static_cast<KeyCode>(key), 0);
-                data.event_callback(event);
+                data.event_queue.push<KeyPressedEvent>(
+                    static_cast<KeyCode>(key),
+                    0);
                 break;
             }
             case GLFW_RELEASE:
             {
-                KeyReleasedEvent event(static_cast<KeyCode>(key));
-                data.event_callback(event);
+                data.event_queue.push<KeyReleasedEvent>(
+                    static_cast<KeyCode>(key));
                 break;
             }
             case GLFW_REPEAT:
             {
-                KeyPressedEvent event(static_cast<KeyCode>(key), 1);
-                data.event_callback(event);
+                data.event_queue.push<KeyPressedEvent>(
+                    static_cast<KeyCode>(key),
+                    1);
                 break;
             }
             }
@@ -118,8 +117,7 @@ void WindowsWindow::Init()
         [](GLFWwindow* window, unsigned int key)
         {
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-            KeyTypedEvent event(static_cast<KeyCode>(key));
-            data.event_callback(event);
+            data.event_queue.push<KeyTypedEvent>(static_cast<KeyCode>(key));
         });
 
     glfwSetMouseButtonCallback(m_window,
@@ -130,14 +128,14 @@ void WindowsWindow::Init()
             {
             case GLFW_PRESS:
             {
-                MouseButtonPressedEvent event(static_cast<MouseCode>(button));
-                data.event_callback(event);
+                data.event_queue.push<MouseButtonPressedEvent>(
+                    static_cast<MouseCode>(button));
                 break;
             }
             case GLFW_RELEASE:
             {
-                MouseButtonReleasedEvent event(static_cast<MouseCode>(button));
-                data.event_callback(event);
+                data.event_queue.push<MouseButtonReleasedEvent>(
+                    static_cast<MouseCode>(button));
                 break;
             }
             }
@@ -147,21 +145,27 @@ void WindowsWindow::Init()
         [](GLFWwindow* window, double offset_x, double offset_y)
         {
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-            MouseScrolledEvent event((float)offset_x, (float)offset_y);
-            data.event_callback(event);
+            data.event_queue.push<MouseScrolledEvent>((float)offset_x,
+                (float)offset_y);
         });
 
     glfwSetCursorPosCallback(m_window,
         [](GLFWwindow* window, double pos_x, double pos_y)
         {
             WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
-            MouseMovedEvent event((float)pos_x, (float)pos_y);
-            data.event_callback(event);
+            data.event_queue.push<MouseMovedEvent>((float)pos_x, (float)pos_y);
         });
 }
 
 void WindowsWindow::poll_events() { glfwPollEvents(); }
 
+void WindowsWindow::wait_events(const double timeout)
+{
+    glfwWaitEventsTimeout(timeout);
+}
+
+void WindowsWindow::post_empty_event() { glfwPostEmptyEvent(); }
+
 void WindowsWindow::swap_buffers() { m_context->swap_buffers(); }
 
 std::pair<uint32_t, uint32_t> WindowsWindow::get_size() const
@@ -186,11 +190,6 @@ void WindowsWindow::center_window()
     glfwSetWindowPos(m_window, x, y);
 }
 
-void WindowsWindow::set_event_callback(const event_callbackFn& callback)
-{
-    m_data.event_callback = callback;
-}
-
 void WindowsWindow::set_vsync(const bool enabled)
 {
     if (enabled)
@@ -0,0 +1,19 @@
+#include "pine/renderer/batch_renderer.hpp"
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+void BatchRenderer::upload(const VertexArray& vertex_array,
+    const void* vertices, const size_t size)
+{
+    const auto* staged = RenderCommand::stage_data(vertices, size);
+    RenderCommand::enqueue(
+        [vertex_array = &vertex_array,
+            staged,
+            size = static_cast<uint32_t>(size)]()
+        { vertex_array->get_vertex_buffer().set_data(staged, size); });
+}
+
+} // namespace pine
@@ -57,6 +57,22 @@ std::unique_ptr<VertexBuffer> VertexBuffer::create(const float* vertices,
     return nullptr;
 }
 
+std::unique_ptr<IndexBuffer> IndexBuffer::create(const uint32_t count)
+{
+    switch (Renderer::get_api())
+    {
+    case RendererAPI::API::None:
+        PINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not \
+				supported!");
+        return nullptr;
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLIndexBuffer>(count);
+    }
+
+    PINE_CORE_ASSERT(false, "Unknown renderer API.");
+    return nullptr;
+}
+
 std::unique_ptr<IndexBuffer> IndexBuffer::create(const uint32_t* indices,
     const uint32_t count)
 {
@@ -74,6 +90,56 @@ std::unique_ptr<IndexBuffer> IndexBuffer::create(const uint32_t* indices,
     return nullptr;
 }
 
+std::unique_ptr<UniformBuffer> UniformBuffer::create(const uint32_t size,
+    const uint32_t binding)
+{
+    switch (Renderer::get_api())
+    {
+    case RendererAPI::API::None:
+        PINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not \
+				supported!");
+        return nullptr;
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLUniformBuffer>(size, binding);
+    }
+
+    PINE_CORE_ASSERT(false, "Unknown renderer API.");
+    return nullptr;
+}
+
+std::unique_ptr<StorageBuffer> StorageBuffer::create(const uint32_t size,
+    const uint32_t binding)
+{
+    switch (Renderer::get_api())
+    {
+    case RendererAPI::API::None:
+        PINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not \
+				supported!");
+        return nullptr;
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLStorageBuffer>(size, binding);
+    }
+
+    PINE_CORE_ASSERT(false, "Unknown renderer API.");
+    return nullptr;
+}
+
+std::unique_ptr<IndirectBuffer> IndirectBuffer::create(const uint32_t size)
+{
+    switch (Renderer::get_api())
+    {
+    case RendererAPI::API::None:
+        PINE_CORE_ASSERT(false, "RendererAPI::API::None is currently not \
+				supported!");
+        return nullptr;
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLIndirectBuffer>(size);
+    }
+
+    PINE_CORE_ASSERT(false, "Unknown renderer API.");
+    return nullptr;
+}
+
 std::unique_ptr<VertexArray> VertexArray::create()
 {
     switch (Renderer::get_api())
@@ -90,4 +156,20 @@ std::unique_ptr<VertexArray> VertexArray::create()
     return nullptr;
 }
 
+std::vector<uint32_t> create_quad_indices(const uint32_t quad_count)
+{
+    std::vector<uint32_t> indices(quad_count * 6);
+    for (uint32_t quad = 0; quad < quad_count; quad++)
+    {
+        const auto offset = quad * 4;
+        indices[quad * 6 + 0] = offset + 0;
+        indices[quad * 6 + 1] = offset + 1;
+        indices[quad * 6 + 2] = offset + 2;
+        indices[quad * 6 + 3] = offset + 2;
+        indices[quad * 6 + 4] = offset + 3;
+        indices[quad * 6 + 5] = offset + 0;
+    }
+    return indices;
+}
+
 } // namespace pine
@@ -120,4 +120,170 @@ bool OrthographicCameraController::on_window_resized(
     return false;
 }
 
+PerspectiveCamera::PerspectiveCamera(const float field_of_view,
+    const float aspect_ratio, const float near_clip, const float far_clip)
+    : projection_matrix(
+        perspective(field_of_view, aspect_ratio, near_clip, far_clip)),
+      view_matrix(1.0f)
+{
+}
+
+void PerspectiveCamera::set_projection(const float field_of_view,
+    const float aspect_ratio, const float near_clip, const float far_clip)
+{
+    projection_matrix =
+        perspective(field_of_view, aspect_ratio, near_clip, far_clip);
+}
+
+Vec3 PerspectiveCamera::get_forward_direction() const
+{
+    return get_orientation() * Vec3(0.0f, 0.0f, -1.0f);
+}
+
+Vec3 PerspectiveCamera::get_right_direction() const
+{
+    return get_orientation() * Vec3(1.0f, 0.0f, 0.0f);
+}
+
+Vec3 PerspectiveCamera::get_up_direction() const
+{
+    return get_orientation() * Vec3(0.0f, 1.0f, 0.0f);
+}
+
+Quat PerspectiveCamera::get_orientation() const
+{
+    return glm::angleAxis(yaw, Vec3(0.0f, 1.0f, 0.0f))
+        * glm::angleAxis(pitch, Vec3(1.0f, 0.0f, 0.0f));
+}
+
+void PerspectiveCamera::update_view_matrix()
+{
+    const Mat4 transform =
+        translate(Mat4(1.0f), position) * glm::mat4_cast(get_orientation());
+    view_matrix = inverse(transform);
+}
+
+PerspectiveCameraController::PerspectiveCameraController(
+    const float aspect_ratio, const float field_of_view)
+    : aspect_ratio(aspect_ratio), field_of_view(field_of_view),
+      camera(field_of_view, aspect_ratio, near_clip, far_clip)
+{
+}
+
+void PerspectiveCameraController::move_forward(const Timestep& ts)
+{
+    move(camera.get_forward_direction(), ts);
+}
+
+void PerspectiveCameraController::move_backward(const Timestep& ts)
+{
+    move(-camera.get_forward_direction(), ts);
+}
+
+void PerspectiveCameraController::move_left(const Timestep& ts)
+{
+    move(-camera.get_right_direction(), ts);
+}
+
+void PerspectiveCameraController::move_right(const Timestep& ts)
+{
+    move(camera.get_right_direction(), ts);
+}
+
+void PerspectiveCameraController::move_up(const Timestep& ts)
+{
+    move(Vec3(0.0f, 1.0f, 0.0f), ts);
+}
+
+void PerspectiveCameraController::move_down(const Timestep& ts)
+{
+    move(Vec3(0.0f, -1.0f, 0.0f), ts);
+}
+
+void PerspectiveCameraController::turn_left(const Timestep& ts)
+{
+    turn(camera_rotation_speed * ts, 0.0f);
+}
+
+void PerspectiveCameraController::turn_right(const Timestep& ts)
+{
+    turn(-camera_rotation_speed * ts, 0.0f);
+}
+
+void PerspectiveCameraController::look_up(const Timestep& ts)
+{
+    turn(0.0f, camera_rotation_speed * ts);
+}
+
+void PerspectiveCameraController::look_down(const Timestep& ts)
+{
+    turn(0.0f, -camera_rotation_speed * ts);
+}
+
+void PerspectiveCameraController::on_event(Event& event)
+{
+    EventDispatcher dispatcher(event);
+    dispatcher.dispatch<MouseScrolledEvent>(
+        [this](const MouseScrolledEvent& event) -> bool
+        {
+            return on_mouse_scrolled(event);
+        });
+    dispatcher.dispatch<WindowResizeEvent>(
+        [this](const WindowResizeEvent& event) -> bool
+        {
+            return on_window_resized(event);
+        });
+}
+
+void PerspectiveCameraController::on_resize(const float width,
+    const float height)
+{
+    aspect_ratio = width / height;
+    camera.set_projection(field_of_view, aspect_ratio, near_clip, far_clip);
+}
+
+void PerspectiveCameraController::set_position(const Vec3& position)
+{
+    camera.set_position(position);
+}
+
+void PerspectiveCameraController::set_orientation(const float yaw,
+    const float pitch)
+{
+    turn(yaw - camera.get_yaw(), pitch - camera.get_pitch());
+}
+
+bool PerspectiveCameraController::on_mouse_scrolled(
+    const MouseScrolledEvent& event)
+{
+    // Each step of the wheel changes the speed by a quarter.
+    camera_linear_speed *= std::pow(1.25f, event.get_offset_y());
+    camera_linear_speed = std::clamp(camera_linear_speed, 0.1f, 1000.0f);
+    return false;
+}
+
+bool PerspectiveCameraController::on_window_resized(
+    const WindowResizeEvent& event)
+{
+    on_resize(static_cast<float>(event.get_width()),
+        static_cast<float>(event.get_height()));
+    return false;
+}
+
+void PerspectiveCameraController::move(const Vec3& direction,
+    const Timestep& ts)
+{
+    camera.set_position(
+        camera.get_position() + direction * (camera_linear_speed * ts));
+}
+
+void PerspectiveCameraController::turn(const float yaw_delta,
+    const float pitch_delta)
+{
+    // The pitch stops short of the poles, where the yaw is undefined.
+    const auto max_pitch = radians(89.0f);
+    camera.set_orientation(camera.get_yaw() + yaw_delta,
+        std::clamp(camera.get_pitch() + pitch_delta, -max_pitch, max_pitch));
+}
+
 } // namespace pine
@@ -0,0 +1,143 @@
+#include "pine/renderer/circle_renderer.hpp"
+
+#include "pine/pch.hpp"
+#include "pine/renderer/batch_renderer.hpp"
+#include "pine/renderer/quad_renderer.hpp"
+#include "pine/renderer/render_command.hpp"
+#include "pine/renderer/renderer.hpp"
+
+namespace pine
+{
+
+static constexpr bool is_circle_within_capabilities(
+    const CircleRenderData& data)
+{
+    return data.circle_vertex_count + CircleRenderCaps::vertices_per_circle
+        <= CircleRenderCaps::max_vertices;
+}
+
+CircleRenderData CircleRenderer::init(
+    const std::shared_ptr<Shader>& circle_shader)
+{
+    CircleRenderData data;
+
+    auto vertex_buffer = VertexBuffer::create(
+        CircleRenderCaps::max_vertices * sizeof(CircleVertex));
+    vertex_buffer->set_layout({
+        {"a_Position", ShaderDataType::Float3},
+        {"a_LocalPosition", ShaderDataType::Float2},
+        {"a_Color", ShaderDataType::Float4},
+        {"a_Thickness", ShaderDataType::Float},
+        {"a_Fade", ShaderDataType::Float},
+    });
+
+    data.circle_vertex_array = VertexArray::create();
+    data.circle_vertex_array->set_vertex_buffer(std::move(vertex_buffer));
+
+    const auto circle_indices =
+        create_quad_indices(CircleRenderCaps::max_circles);
+    data.circle_vertex_array->set_index_buffer(
+        IndexBuffer::create(circle_indices.data(),
+            static_cast<uint32_t>(circle_indices.size())));
+
+    data.circle_shader = circle_shader
+        ? circle_shader
+        : Shader::create("resources/shaders/circle_shader.glsl");
+
+    return data;
+}
+
+void CircleRenderer::shutdown(CircleRenderData& data)
+{
+    data.circle_vertex_count = 0;
+    data.circle_index_count = 0;
+}
+
+void CircleRenderer::begin_scene(CircleRenderData& data)
+{
+    data.circle_vertex_count = 0;
+    data.circle_index_count = 0;
+
+    data.statistics.draw_calls = 0;
+    data.statistics.circle_count = 0;
+}
+
+void CircleRenderer::end_scene(CircleRenderData& data)
+{
+    if (data.circle_index_count == 0)
+    {
+        return;
+    }
+
+    BatchRenderer::upload(*data.circle_vertex_array,
+        data.circle_vertices.data(),
+        data.circle_vertex_count * sizeof(CircleVertex));
+    flush(data);
+}
+
+void CircleRenderer::flush(CircleRenderData& data)
+{
+    PINE_PROFILE_FUNCTION();
+
+    BatchRenderer::draw("CircleRenderer::flush",
+        *data.circle_shader,
+        *data.circle_vertex_array,
+        data.circle_index_count);
+
+    data.statistics.draw_calls++;
+}
+
+void CircleRenderer::flush_and_reset(CircleRenderData& data)
+{
+    end_scene(data);
+    data.circle_vertex_count = 0;
+    data.circle_index_count = 0;
+}
+
+void CircleRenderer::draw_circle(CircleRenderData& data, const Vec2& position,
+    const float radius, const Vec4& color, const float thickness,
+    const float fade)
+{
+    draw_circle(data,
+        {position.x, position.y, 0.0f},
+        radius,
+        color,
+        thickness,
+        fade);
+}
+
+void CircleRenderer::draw_circle(CircleRenderData& data, const Vec3& position,
+    const float radius, const Vec4& color, const float thickness,
+    const float fade)
+{
+    const Mat4 transform = translate(Mat4(1.0f), position)
+        * scale(Mat4(1.0f), Vec3(2.0f * radius, 2.0f * radius, 1.0f));
+
+    draw_circle(data, transform, color, thickness, fade);
+}
+
+void CircleRenderer::draw_circle(CircleRenderData& data,
+    const Mat4& transform, const Vec4& color, const float thickness,
+    const float fade)
+{
+    if (!is_circle_within_capabilities(data))
+    {
+        flush_and_reset(data);
+    }
+
+    for (uint32_t i = 0; i < CircleRenderCaps::vertices_per_circle; i++)
+    {
+        const auto& corner = QuadRenderCaps::quad_vertex_positions[i];
+        auto& vertex = data.circle_vertices[data.circle_vertex_count++];
+        vertex.position = transform * corner;
+        vertex.local_position = Vec2(corner.x, corner.y) * 2.0f;
+        vertex.color = color;
+        vertex.thickness = thickness;
+        vertex.fade = fade;
+    }
+
+    data.circle_index_count += CircleRenderCaps::indices_per_circle;
+    data.statistics.circle_count++;
+}
+
+} // namespace pine
@@ -0,0 +1,183 @@
+#include "pine/renderer/font.hpp"
+
+#define STB_TRUETYPE_IMPLEMENTATION
+
+#include <stb_truetype.h>
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "pine/pch.hpp"
+#include "pine/renderer/image.hpp"
+
+namespace pine
+{
+
+// Distance field spread in pixels around the glyph outlines.
+static constexpr int s_glyph_padding = 6;
+static constexpr unsigned char s_on_edge_value = 128;
+static constexpr uint32_t s_atlas_width = 512;
+
+struct GlyphBitmap
+{
+    unsigned char* data = nullptr;
+    int width = 0;
+    int height = 0;
+    int offset_x = 0;
+    int offset_y = 0;
+    uint32_t atlas_x = 0;
+    uint32_t atlas_y = 0;
+};
+
+Font::Font(const std::filesystem::path& filepath, const float glyph_size)
+{
+    std::ifstream input_stream(filepath, std::ios::in | std::ios::binary);
+    const std::vector<unsigned char> font_data(
+        (std::istreambuf_iterator<char>(input_stream)),
+        std::istreambuf_iterator<char>());
+
+    stbtt_fontinfo font_info;
+    if (font_data.empty()
+        || !stbtt_InitFont(&font_info,
+            font_data.data(),
+            stbtt_GetFontOffsetForIndex(font_data.data(), 0)))
+    {
+        PINE_CORE_ERROR("Could not load font {0}.", filepath.string());
+        return;
+    }
+
+    const auto scale = stbtt_ScaleForPixelHeight(&font_info, glyph_size);
+    const auto to_units = scale / glyph_size;
+
+    auto ascent = 0;
+    auto descent = 0;
+    auto line_gap = 0;
+    stbtt_GetFontVMetrics(&font_info, &ascent, &descent, &line_gap);
+    m_ascent = static_cast<float>(ascent) * to_units;
+    m_line_spacing = static_cast<float>(ascent - descent + line_gap) * to_units;
+
+    // Rasterize the distance fields and pack them into rows.
+    std::array<GlyphBitmap, glyph_count> bitmaps = {};
+    uint32_t pen_x = 0;
+    uint32_t pen_y = 0;
+    uint32_t row_height = 0;
+    for (uint32_t index = 0; index < glyph_count; index++)
+    {
+        const auto codepoint =
+            static_cast<int>(first_character) + static_cast<int>(index);
+        auto& bitmap = bitmaps[index];
+        bitmap.data = stbtt_GetCodepointSDF(&font_info,
+            scale,
+            codepoint,
+            s_glyph_padding,
+            s_on_edge_value,
+            static_cast<float>(s_on_edge_value) / s_glyph_padding,
+            &bitmap.width,
+            &bitmap.height,
+            &bitmap.offset_x,
+            &bitmap.offset_y);
+
+        const auto width = static_cast<uint32_t>(bitmap.width);
+        const auto height = static_cast<uint32_t>(bitmap.height);
+        if (pen_x + width > s_atlas_width)
+        {
+            pen_x = 0;
+            pen_y += row_height;
+            row_height = 0;
+        }
+        bitmap.atlas_x = pen_x;
+        bitmap.atlas_y = pen_y;
+        pen_x += width;
+        row_height = std::max(row_height, height);
+
+        auto advance = 0;
+        auto left_side_bearing = 0;
+        stbtt_GetCodepointHMetrics(&font_info,
+            codepoint,
+            &advance,
+            &left_side_bearing);
+        m_glyphs[index].advance = static_cast<float>(advance) * to_units;
+
+        for (uint32_t other = 0; other < glyph_count; other++)
+        {
+            const auto kerning = stbtt_GetCodepointKernAdvance(&font_info,
+                codepoint,
+                static_cast<int>(first_character) + static_cast<int>(other));
+            m_kerning[index * glyph_count + other] =
+                static_cast<float>(kerning) * to_units;
+        }
+    }
+
+    uint32_t atlas_height = 1;
+    while (atlas_height < pen_y + row_height)
+    {
+        atlas_height *= 2;
+    }
+
+    const auto atlas_size = Vec2(static_cast<float>(s_atlas_width),
+        static_cast<float>(atlas_height));
+    std::vector<uint8_t> atlas(s_atlas_width * atlas_height, 0);
+    for (uint32_t index = 0; index < glyph_count; index++)
+    {
+        auto& bitmap = bitmaps[index];
+        if (!bitmap.data)
+        {
+            continue;
+        }
+
+        const auto width = static_cast<uint32_t>(bitmap.width);
+        const auto height = static_cast<uint32_t>(bitmap.height);
+        for (uint32_t row = 0; row < height; row++)
+        {
+            std::copy_n(bitmap.data + row * width,
+                width,
+                atlas.begin() + (bitmap.atlas_y + row) * s_atlas_width
+                    + bitmap.atlas_x);
+        }
+        stbtt_FreeSDF(bitmap.data, nullptr);
+
+        // Bitmaps are stored top row first, and their offsets point down.
+        const auto left = static_cast<float>(bitmap.offset_x);
+        const auto top = -static_cast<float>(bitmap.offset_y);
+        auto& glyph = m_glyphs[index];
+        glyph.min = Vec2(left, top - static_cast<float>(height)) / glyph_size;
+        glyph.max = Vec2(left + static_cast<float>(width), top) / glyph_size;
+
+        const auto atlas_left = static_cast<float>(bitmap.atlas_x);
+        const auto atlas_top = static_cast<float>(bitmap.atlas_y);
+        glyph.texture_min =
+            Vec2(atlas_left, atlas_top + static_cast<float>(height))
+            / atlas_size;
+        glyph.texture_max =
+            Vec2(atlas_left + static_cast<float>(width), atlas_top)
+            / atlas_size;
+    }
+
+    const Image image(atlas.data(),
+        s_atlas_width,
+        atlas_height,
+        ImageFormat::GRAY);
+    m_atlas = Texture2D::create(image, TextureFilter::LINEAR);
+}
+
+uint32_t Font::get_index(const char character)
+{
+    if (character < first_character || character > last_character)
+    {
+        return static_cast<uint32_t>('?' - first_character);
+    }
+    return static_cast<uint32_t>(character - first_character);
+}
+
+const Glyph& Font::get_glyph(const char character) const
+{
+    return m_glyphs[get_index(character)];
+}
+
+float Font::get_kerning(const char first, const char second) const
+{
+    return m_kerning[get_index(first) * glyph_count + get_index(second)];
+}
+
+} // namespace pine
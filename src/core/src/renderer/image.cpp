@@ -50,6 +50,10 @@ constexpr ImageFileFormat parse_image_file_format(
     {
         return ImageFileFormat::JPG;
     }
+    else if (file_extension == ".qoi")
+    {
+        return ImageFileFormat::QOI;
+    }
     else
     {
         PINE_CORE_ASSERT(false, "Invalid image file format.");
@@ -85,7 +89,144 @@ Image::Image(const uint8_t* data, const uint32_t width, const uint32_t height,
     : width(width), height(height), format(format)
 {
     const auto channels = get_format_channel_count(format);
-    buffer = std::vector<uint8_t>(data, data + width * height * channels);
+    buffer = BufferType(data, data + width * height * channels);
+}
+
+void Image::flip_vertically()
+{
+    const auto row_size =
+        static_cast<size_t>(width) * get_format_channel_count(format);
+    for (uint32_t row = 0; row < height / 2; row++)
+    {
+        const auto top = buffer.begin()
+            + static_cast<std::ptrdiff_t>(row * row_size);
+        const auto bottom = buffer.begin()
+            + static_cast<std::ptrdiff_t>((height - row - 1) * row_size);
+        std::swap_ranges(top,
+            top + static_cast<std::ptrdiff_t>(row_size),
+            bottom);
+    }
+}
+
+// QOI encoder, see https://qoiformat.org/qoi-specification.pdf. Trades
+// compression ratio for speed, which makes it suitable for frame capture.
+static bool write_qoi(const std::filesystem::path& filepath,
+    const Image& image)
+{
+    static constexpr uint8_t op_index = 0x00;
+    static constexpr uint8_t op_diff = 0x40;
+    static constexpr uint8_t op_luma = 0x80;
+    static constexpr uint8_t op_run = 0xc0;
+    static constexpr uint8_t op_rgb = 0xfe;
+    static constexpr uint8_t op_rgba = 0xff;
+    static constexpr std::array<uint8_t, 8> end_marker =
+        {0, 0, 0, 0, 0, 0, 0, 1};
+
+    const auto channels = get_format_channel_count(image.get_format());
+    if (channels != 3 && channels != 4)
+    {
+        PINE_CORE_ERROR("QOI only supports RGB and RGBA images.");
+        return false;
+    }
+
+    const auto& pixels = image.get_buffer();
+    const auto pixel_count =
+        static_cast<size_t>(image.get_width()) * image.get_height();
+
+    std::vector<uint8_t> bytes;
+    bytes.reserve(14 + pixel_count * (channels + 1) + end_marker.size());
+
+    const auto push_u32 = [&bytes](const uint32_t value)
+    {
+        bytes.push_back(static_cast<uint8_t>(value >> 24));
+        bytes.push_back(static_cast<uint8_t>(value >> 16));
+        bytes.push_back(static_cast<uint8_t>(value >> 8));
+        bytes.push_back(static_cast<uint8_t>(value));
+    };
+
+    bytes.insert(bytes.end(), {'q', 'o', 'i', 'f'});
+    push_u32(image.get_width());
+    push_u32(image.get_height());
+    bytes.push_back(static_cast<uint8_t>(channels));
+    bytes.push_back(0);
+
+    std::array<std::array<uint8_t, 4>, 64> index = {};
+    std::array<uint8_t, 4> previous = {0, 0, 0, 255};
+    uint8_t run = 0;
+
+    for (size_t i = 0; i < pixel_count; i++)
+    {
+        const auto p = pixels.data() + i * channels;
+        const std::array<uint8_t, 4> pixel =
+            {p[0], p[1], p[2], channels == 4 ? p[3] : previous[3]};
+
+        if (pixel == previous)
+        {
+            run++;
+            if (run == 62 || i + 1 == pixel_count)
+            {
+                bytes.push_back(static_cast<uint8_t>(op_run | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+
+        if (run > 0)
+        {
+            bytes.push_back(static_cast<uint8_t>(op_run | (run - 1)));
+            run = 0;
+        }
+
+        const auto position =
+            (pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64;
+        if (index[static_cast<size_t>(position)] == pixel)
+        {
+            bytes.push_back(static_cast<uint8_t>(op_index | position));
+        }
+        else if (pixel[3] == previous[3])
+        {
+            index[static_cast<size_t>(position)] = pixel;
+
+            const auto dr = static_cast<int8_t>(pixel[0] - previous[0]);
+            const auto dg = static_cast<int8_t>(pixel[1] - previous[1]);
+            const auto db = static_cast<int8_t>(pixel[2] - previous[2]);
+            const auto dr_dg = dr - dg;
+            const auto db_dg = db - dg;
+
+            if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2)
+            {
+                bytes.push_back(static_cast<uint8_t>(
+                    op_diff | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+            }
+            else if (dr_dg > -9 && dr_dg < 8 && dg > -33 && dg < 32
+                && db_dg > -9 && db_dg < 8)
+            {
+                bytes.push_back(static_cast<uint8_t>(op_luma | (dg + 32)));
+                bytes.push_back(
+                    static_cast<uint8_t>((dr_dg + 8) << 4 | (db_dg + 8)));
+            }
+            else
+            {
+                bytes.insert(bytes.end(),
+                    {op_rgb, pixel[0], pixel[1], pixel[2]});
+            }
+        }
+        else
+        {
+            index[static_cast<size_t>(position)] = pixel;
+            bytes.insert(bytes.end(),
+                {op_rgba, pixel[0], pixel[1], pixel[2], pixel[3]});
+        }
+
+        previous = pixel;
+    }
+
+    bytes.insert(bytes.end(), end_marker.begin(), end_marker.end());
+
+    std::ofstream output_stream(filepath, std::ios::out | std::ios::binary);
+    output_stream.write(reinterpret_cast<const char*>(bytes.data()),
+        static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(output_stream);
 }
 
 Image read_image(const std::filesystem::path& filepath, const bool flip)
@@ -96,12 +237,22 @@ Image read_image(const std::filesystem::path& filepath, const bool flip)
 
     const auto data =
         stbi_load(filepath.c_str(), &width, &height, &channels, 0);
+    if (!data)
+    {
+        PINE_CORE_ERROR("Could not read image {0}: {1}",
+            filepath.string(),
+            stbi_failure_reason());
+        return Image();
+    }
     const auto format = parse_image_format(channels);
 
-    return Image(data,
+    // The image keeps a copy of the pixels.
+    auto image = Image(data,
         static_cast<uint32_t>(width),
         static_cast<uint32_t>(height),
         format);
+    stbi_image_free(data);
+    return image;
 }
 
 Image read_image(const std::filesystem::path& filepath,
@@ -117,23 +268,40 @@ Image read_image(const std::filesystem::path& filepath,
         &height,
         &channels,
         static_cast<int>(desired_channels));
+    if (!data)
+    {
+        PINE_CORE_ERROR("Could not read image {0}: {1}",
+            filepath.string(),
+            stbi_failure_reason());
+        return Image();
+    }
 
-    return Image(data,
+    auto image = Image(data,
         static_cast<uint32_t>(width),
         static_cast<uint32_t>(height),
         format);
+    stbi_image_free(data);
+    return image;
 }
 
 bool write_image(const std::filesystem::path& filepath, const Image& image,
-    const bool flip)
+    const bool flip, const int quality)
 {
     const auto file_extension = filepath.extension();
     const auto file_format = parse_image_file_format(file_extension.c_str());
 
-    stbi_set_flip_vertically_on_load(flip);
+    // The stb flip flag is global state shared between threads, so flipped
+    // images are written from a flipped copy instead.
+    if (flip)
+    {
+        auto flipped = image;
+        flipped.flip_vertically();
+        return write_image(filepath, flipped, false, quality);
+    }
 
     const auto channels = get_format_channel_count(image.get_format());
-    const auto write_result = [filepath, image, channels, file_format]()
+    const auto write_result = [&filepath, &image, channels, file_format,
+                                  quality]()
     {
         switch (file_format)
         {
@@ -143,7 +311,7 @@ bool write_image(const std::filesystem::path& filepath, const Image& image,
                 static_cast<int>(image.get_height()),
                 static_cast<int>(channels),
                 image.get_buffer().data(),
-                100);
+                std::clamp(quality, 1, 100));
         case ImageFileFormat::PNG:
             return stbi_write_png(filepath.c_str(),
                 static_cast<int>(image.get_width()),
@@ -163,6 +331,8 @@ bool write_image(const std::filesystem::path& filepath, const Image& image,
                 static_cast<int>(image.get_height()),
                 static_cast<int>(channels),
                 image.get_buffer().data());
+        case ImageFileFormat::QOI:
+            return write_qoi(filepath, image) ? 1 : 0;
         }
         return 0;
     }();
@@ -0,0 +1,133 @@
+#include "pine/renderer/image_writer.hpp"
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+ImageWriter::ImageWriter(const ImageWriterSpecs& specs) : m_specs(specs)
+{
+    m_specs.worker_count = std::max(m_specs.worker_count, 1u);
+    m_specs.queue_capacity = std::max(m_specs.queue_capacity, 1u);
+
+    m_workers.reserve(m_specs.worker_count);
+    for (uint32_t i = 0; i < m_specs.worker_count; i++)
+    {
+        m_workers.emplace_back([this]() { run_worker(); });
+    }
+}
+
+ImageWriter::~ImageWriter()
+{
+    // Pending images are still written before the workers exit.
+    {
+        std::scoped_lock lock(m_mutex);
+        m_stopping = true;
+    }
+    m_job_available.notify_all();
+    m_slot_available.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+bool ImageWriter::submit(const std::filesystem::path& filepath, Image&& image,
+    const bool flip)
+{
+    m_submitted++;
+    {
+        std::unique_lock lock(m_mutex);
+        if (m_specs.policy == ImageWriterPolicy::BLOCK)
+        {
+            m_slot_available.wait(lock,
+                [this]()
+                {
+                    return m_stopping
+                        || m_jobs.size() < m_specs.queue_capacity;
+                });
+        }
+
+        if (m_stopping || m_jobs.size() >= m_specs.queue_capacity)
+        {
+            m_dropped++;
+            return false;
+        }
+
+        m_jobs.push_back({filepath, std::move(image), flip});
+    }
+    m_job_available.notify_one();
+    return true;
+}
+
+void ImageWriter::wait_idle()
+{
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_jobs.empty() && !m_active_jobs; });
+}
+
+uint64_t ImageWriter::get_pending_count() const
+{
+    std::scoped_lock lock(m_mutex);
+    return m_jobs.size() + m_active_jobs;
+}
+
+ImageWriterStats ImageWriter::get_stats() const
+{
+    return {m_submitted.load(),
+        m_written.load(),
+        m_dropped.load(),
+        m_failed.load()};
+}
+
+void ImageWriter::run_worker()
+{
+    while (true)
+    {
+        WriteJob job;
+        {
+            std::unique_lock lock(m_mutex);
+            m_job_available.wait(lock,
+                [this]() { return m_stopping || !m_jobs.empty(); });
+
+            if (m_jobs.empty())
+            {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+            m_active_jobs++;
+        }
+        m_slot_available.notify_one();
+
+        // The job owns the image, flip it in place instead of copying.
+        if (job.flip)
+        {
+            job.image.flip_vertically();
+        }
+
+        if (write_image(job.filepath, job.image, false, m_specs.quality))
+        {
+            m_written++;
+        }
+        else
+        {
+            m_failed++;
+            PINE_CORE_WARN("Could not write image '{0}'",
+                job.filepath.string());
+        }
+
+        {
+            std::scoped_lock lock(m_mutex);
+            m_active_jobs--;
+            if (m_jobs.empty() && !m_active_jobs)
+            {
+                m_idle.notify_all();
+            }
+        }
+    }
+}
+
+} // namespace pine
@@ -0,0 +1,158 @@
+#include "pine/renderer/line_renderer.hpp"
+
+#include "pine/pch.hpp"
+#include "pine/renderer/batch_renderer.hpp"
+#include "pine/renderer/quad_renderer.hpp"
+#include "pine/renderer/render_command.hpp"
+#include "pine/renderer/renderer.hpp"
+
+namespace pine
+{
+
+static constexpr bool is_line_within_capabilities(const LineRenderData& data)
+{
+    return data.line_vertex_count + LineRenderCaps::vertices_per_line
+        <= LineRenderCaps::max_vertices;
+}
+
+LineRenderData LineRenderer::init(const std::shared_ptr<Shader>& line_shader)
+{
+    LineRenderData data;
+
+    auto vertex_buffer =
+        VertexBuffer::create(LineRenderCaps::max_vertices * sizeof(LineVertex));
+    vertex_buffer->set_layout({
+        {"a_Position", ShaderDataType::Float3},
+        {"a_OtherPosition", ShaderDataType::Float3},
+        {"a_Color", ShaderDataType::Float4},
+        {"a_Side", ShaderDataType::Float},
+        {"a_Width", ShaderDataType::Float},
+    });
+
+    data.line_vertex_array = VertexArray::create();
+    data.line_vertex_array->set_vertex_buffer(std::move(vertex_buffer));
+
+    const auto line_indices = create_quad_indices(LineRenderCaps::max_lines);
+    data.line_vertex_array->set_index_buffer(
+        IndexBuffer::create(line_indices.data(),
+            static_cast<uint32_t>(line_indices.size())));
+
+    data.line_shader = line_shader
+        ? line_shader
+        : Shader::create("resources/shaders/line_shader.glsl");
+
+    return data;
+}
+
+void LineRenderer::shutdown(LineRenderData& data)
+{
+    data.line_vertex_count = 0;
+    data.line_index_count = 0;
+}
+
+void LineRenderer::begin_scene(LineRenderData& data)
+{
+    data.line_vertex_count = 0;
+    data.line_index_count = 0;
+
+    data.statistics.draw_calls = 0;
+    data.statistics.line_count = 0;
+}
+
+void LineRenderer::end_scene(LineRenderData& data)
+{
+    if (data.line_index_count == 0)
+    {
+        return;
+    }
+
+    BatchRenderer::upload(*data.line_vertex_array,
+        data.line_vertices.data(),
+        data.line_vertex_count * sizeof(LineVertex));
+    flush(data);
+}
+
+void LineRenderer::flush(LineRenderData& data)
+{
+    PINE_PROFILE_FUNCTION();
+
+    BatchRenderer::draw("LineRenderer::flush",
+        *data.line_shader,
+        *data.line_vertex_array,
+        data.line_index_count);
+
+    data.statistics.draw_calls++;
+}
+
+void LineRenderer::flush_and_reset(LineRenderData& data)
+{
+    end_scene(data);
+    data.line_vertex_count = 0;
+    data.line_index_count = 0;
+}
+
+void LineRenderer::draw_line(LineRenderData& data, const Vec2& start,
+    const Vec2& end, const Vec4& color, const float width)
+{
+    draw_line(data,
+        {start.x, start.y, 0.0f},
+        {end.x, end.y, 0.0f},
+        color,
+        width);
+}
+
+void LineRenderer::draw_line(LineRenderData& data, const Vec3& start,
+    const Vec3& end, const Vec4& color, const float width)
+{
+    if (!is_line_within_capabilities(data))
+    {
+        flush_and_reset(data);
+    }
+
+    // The normal flips with the direction, so the sides of the end vertices
+    // are flipped as well to keep the winding.
+    const std::array<LineVertex, LineRenderCaps::vertices_per_line> vertices =
+        {{
+            {start, end, color, 1.0f, width},
+            {start, end, color, -1.0f, width},
+            {end, start, color, 1.0f, width},
+            {end, start, color, -1.0f, width},
+        }};
+    for (const auto& vertex : vertices)
+    {
+        data.line_vertices[data.line_vertex_count++] = vertex;
+    }
+
+    data.line_index_count += LineRenderCaps::indices_per_line;
+    data.statistics.line_count++;
+}
+
+void LineRenderer::draw_rect(LineRenderData& data, const Vec3& position,
+    const Vec2& size, const Vec4& color, const float width)
+{
+    const Mat4 transform = translate(Mat4(1.0f), position)
+        * scale(Mat4(1.0f), Vec3(size.x, size.y, 1.0f));
+
+    draw_rect(data, transform, color, width);
+}
+
+void LineRenderer::draw_rect(LineRenderData& data, const Mat4& transform,
+    const Vec4& color, const float width)
+{
+    std::array<Vec3, QuadRenderCaps::vertices_per_quad> corners;
+    for (uint32_t i = 0; i < corners.size(); i++)
+    {
+        corners[i] = transform * QuadRenderCaps::quad_vertex_positions[i];
+    }
+
+    for (uint32_t i = 0; i < corners.size(); i++)
+    {
+        draw_line(data,
+            corners[i],
+            corners[(i + 1) % corners.size()],
+            color,
+            width);
+    }
+}
+
+} // namespace pine
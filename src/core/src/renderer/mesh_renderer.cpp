@@ -0,0 +1,296 @@
+#include "pine/renderer/mesh_renderer.hpp"
+
+#include <array>
+#include <utility>
+
+#include "pine/debug/gpu_instrumentor.hpp"
+#include "pine/pch.hpp"
+#include "pine/renderer/render_command.hpp"
+#include "pine/renderer/renderer.hpp"
+
+namespace pine
+{
+
+MeshRenderData MeshRenderer::init(const std::shared_ptr<Shader>& mesh_shader)
+{
+    MeshRenderData data;
+
+    auto vertex_buffer =
+        VertexBuffer::create(MeshRenderCaps::max_vertices * sizeof(MeshVertex));
+    vertex_buffer->set_layout({
+        {"a_Position", ShaderDataType::Float3},
+        {"a_Normal", ShaderDataType::Float3},
+        {"a_Color", ShaderDataType::Float4},
+    });
+
+    data.mesh_vertex_array = VertexArray::create();
+    data.mesh_vertex_array->set_vertex_buffer(std::move(vertex_buffer));
+    data.mesh_vertex_array->set_index_buffer(
+        IndexBuffer::create(MeshRenderCaps::max_indices));
+
+    data.draw_buffer =
+        StorageBuffer::create(MeshRenderCaps::max_draws * sizeof(MeshDrawData),
+            MeshRenderCaps::draw_binding);
+    data.indirect_buffer = IndirectBuffer::create(
+        MeshRenderCaps::max_draws * sizeof(DrawIndexedIndirectCommand));
+
+    data.mesh_shader = mesh_shader
+        ? mesh_shader
+        : Shader::create("resources/shaders/mesh_shader.glsl");
+
+    return data;
+}
+
+void MeshRenderer::shutdown(MeshRenderData& data)
+{
+    data.draws.clear();
+    data.triangle_commands.clear();
+    data.point_commands.clear();
+}
+
+MeshID MeshRenderer::upload_mesh(MeshRenderData& data, const MeshData& mesh)
+{
+    PINE_CORE_ASSERT(mesh.primitive == RendererPrimitives::Triangles
+            || mesh.primitive == RendererPrimitives::Points,
+        "Meshes must be triangles or points.");
+
+    const auto vertex_count = static_cast<uint32_t>(mesh.vertices.size());
+    const auto index_count = static_cast<uint32_t>(mesh.indices.size());
+    if (vertex_count == 0 || index_count == 0)
+    {
+        PINE_CORE_ERROR("Cannot upload an empty mesh.");
+        return MeshRenderCaps::invalid_mesh;
+    }
+    if (data.mesh_vertex_count + vertex_count > MeshRenderCaps::max_vertices
+        || data.mesh_index_count + index_count > MeshRenderCaps::max_indices)
+    {
+        PINE_CORE_ERROR("Mesh of {0} vertices does not fit in the mesh "
+                        "buffers.",
+            vertex_count);
+        return MeshRenderCaps::invalid_mesh;
+    }
+
+    MeshRange range;
+    range.first_index = data.mesh_index_count;
+    range.index_count = index_count;
+    range.base_vertex = static_cast<int32_t>(data.mesh_vertex_count);
+    range.primitive = mesh.primitive;
+
+    const auto vertex_size =
+        static_cast<uint32_t>(vertex_count * sizeof(MeshVertex));
+    const auto vertex_offset =
+        static_cast<uint32_t>(data.mesh_vertex_count * sizeof(MeshVertex));
+    const auto vertices =
+        RenderCommand::stage_data(mesh.vertices.data(), vertex_size);
+    const auto indices = RenderCommand::stage_data(mesh.indices.data(),
+        index_count * sizeof(uint32_t));
+
+    RenderCommand::enqueue(
+        [vertex_array = data.mesh_vertex_array.get(),
+            vertices,
+            vertex_size,
+            vertex_offset,
+            indices,
+            index_count,
+            index_offset = data.mesh_index_count]()
+        {
+            vertex_array->get_vertex_buffer().set_data(vertices,
+                vertex_size,
+                vertex_offset);
+            vertex_array->get_index_buffer().set_data(
+                static_cast<const uint32_t*>(indices),
+                index_count,
+                index_offset);
+        });
+
+    data.mesh_vertex_count += vertex_count;
+    data.mesh_index_count += index_count;
+    data.meshes.push_back(range);
+
+    data.statistics.mesh_count = static_cast<uint32_t>(data.meshes.size());
+    data.statistics.vertex_count = data.mesh_vertex_count;
+    data.statistics.index_count = data.mesh_index_count;
+
+    return static_cast<MeshID>(data.meshes.size() - 1);
+}
+
+void MeshRenderer::begin_scene(MeshRenderData& data)
+{
+    data.draws.clear();
+    data.triangle_commands.clear();
+    data.point_commands.clear();
+
+    data.statistics.draw_calls = 0;
+    data.statistics.object_count = 0;
+}
+
+void MeshRenderer::end_scene(MeshRenderData& data)
+{
+    if (data.draws.empty())
+    {
+        return;
+    }
+
+    flush(data);
+}
+
+void MeshRenderer::flush(MeshRenderData& data)
+{
+    PINE_PROFILE_FUNCTION();
+
+    const auto triangle_count =
+        static_cast<uint32_t>(data.triangle_commands.size());
+    const auto point_count = static_cast<uint32_t>(data.point_commands.size());
+
+    const auto draw_size =
+        static_cast<uint32_t>(data.draws.size() * sizeof(MeshDrawData));
+    const auto draws = RenderCommand::stage_data(data.draws.data(), draw_size);
+    const auto triangle_size = static_cast<uint32_t>(
+        triangle_count * sizeof(DrawIndexedIndirectCommand));
+    const auto point_size =
+        static_cast<uint32_t>(point_count * sizeof(DrawIndexedIndirectCommand));
+    // One of the command lists may be empty, without any data to stage.
+    const auto triangle_commands = triangle_count > 0
+        ? RenderCommand::stage_data(data.triangle_commands.data(),
+              triangle_size)
+        : nullptr;
+    const auto point_commands = point_count > 0
+        ? RenderCommand::stage_data(data.point_commands.data(), point_size)
+        : nullptr;
+
+    // The point commands follow the triangle commands in the indirect buffer.
+    RenderCommand::enqueue(
+        [shader = data.mesh_shader.get(),
+            draw_buffer = data.draw_buffer.get(),
+            indirect_buffer = data.indirect_buffer.get(),
+            draws,
+            draw_size,
+            triangle_commands,
+            triangle_size,
+            point_commands,
+            point_size]()
+        {
+            PINE_PROFILE_GPU_SCOPE("MeshRenderer::flush");
+            draw_buffer->set_data(draws, draw_size);
+            if (triangle_commands)
+            {
+                indirect_buffer->set_data(triangle_commands, triangle_size);
+            }
+            if (point_commands)
+            {
+                indirect_buffer->set_data(point_commands,
+                    point_size,
+                    triangle_size);
+            }
+
+            shader->bind();
+            draw_buffer->bind();
+        });
+
+    if (triangle_count > 0)
+    {
+        RenderCommand::draw_indexed_indirect(*data.mesh_vertex_array,
+            *data.indirect_buffer,
+            triangle_count,
+            0,
+            RendererPrimitives::Triangles);
+        data.statistics.draw_calls++;
+    }
+    if (point_count > 0)
+    {
+        RenderCommand::draw_indexed_indirect(*data.mesh_vertex_array,
+            *data.indirect_buffer,
+            point_count,
+            triangle_count,
+            RendererPrimitives::Points);
+        data.statistics.draw_calls++;
+    }
+}
+
+void MeshRenderer::flush_and_reset(MeshRenderData& data)
+{
+    end_scene(data);
+    data.draws.clear();
+    data.triangle_commands.clear();
+    data.point_commands.clear();
+}
+
+void MeshRenderer::draw_mesh(MeshRenderData& data, const MeshID mesh,
+    const Mat4& transform, const Vec4& color)
+{
+    if (mesh >= data.meshes.size())
+    {
+        return;
+    }
+
+    if (data.draws.size() >= MeshRenderCaps::max_draws)
+    {
+        flush_and_reset(data);
+    }
+
+    const auto& range = data.meshes[mesh];
+    const auto draw_index = static_cast<uint32_t>(data.draws.size());
+    data.draws.push_back({transform, color});
+    data.statistics.object_count++;
+
+    // Consecutive draws of the same mesh become instances of one command.
+    auto& commands = range.primitive == RendererPrimitives::Points
+        ? data.point_commands
+        : data.triangle_commands;
+    if (!commands.empty())
+    {
+        auto& last = commands.back();
+        if (last.first_index == range.first_index
+            && last.base_vertex == range.base_vertex
+            && last.base_instance + last.instance_count == draw_index)
+        {
+            last.instance_count++;
+            return;
+        }
+    }
+
+    DrawIndexedIndirectCommand command;
+    command.index_count = range.index_count;
+    command.instance_count = 1;
+    command.first_index = range.first_index;
+    command.base_vertex = range.base_vertex;
+    command.base_instance = draw_index;
+    commands.push_back(command);
+}
+
+MeshData create_cube_mesh(const Vec4& color)
+{
+    // Normal, and the two axes that span the face.
+    static constexpr std::array<std::array<Vec3, 3>, 6> faces = {{
+        {{{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}}},
+        {{{-1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}}},
+        {{{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}}},
+        {{{0.0f, -1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}},
+        {{{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+        {{{0.0f, 0.0f, -1.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+    }};
+    static constexpr std::array<Vec2, 4> corners = {{
+        {-0.5f, -0.5f},
+        {0.5f, -0.5f},
+        {0.5f, 0.5f},
+        {-0.5f, 0.5f},
+    }};
+
+    MeshData mesh;
+    for (const auto& [normal, tangent, bitangent] : faces)
+    {
+        for (const auto& corner : corners)
+        {
+            MeshVertex vertex;
+            vertex.position =
+                normal * 0.5f + tangent * corner.x + bitangent * corner.y;
+            vertex.normal = normal;
+            vertex.color = color;
+            mesh.vertices.push_back(vertex);
+        }
+    }
+    mesh.indices = create_quad_indices(static_cast<uint32_t>(faces.size()));
+    return mesh;
+}
+
+} // namespace pine
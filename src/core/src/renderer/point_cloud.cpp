@@ -0,0 +1,466 @@
+#include "pine/renderer/point_cloud.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <optional>
+
+#include "pine/core/job_system.hpp"
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+enum class PlyFormat
+{
+    ASCII,
+    BINARY_LITTLE_ENDIAN
+};
+
+enum class PlyType
+{
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    FLOAT32,
+    FLOAT64
+};
+
+struct PlyProperty
+{
+    std::string name = {};
+    PlyType type = PlyType::FLOAT32;
+    // Offset within a vertex of a binary file.
+    uint32_t offset = 0;
+};
+
+static std::optional<PlyType> parse_ply_type(const std::string& name)
+{
+    if (name == "char" || name == "int8")
+        return PlyType::INT8;
+    if (name == "uchar" || name == "uint8")
+        return PlyType::UINT8;
+    if (name == "short" || name == "int16")
+        return PlyType::INT16;
+    if (name == "ushort" || name == "uint16")
+        return PlyType::UINT16;
+    if (name == "int" || name == "int32")
+        return PlyType::INT32;
+    if (name == "uint" || name == "uint32")
+        return PlyType::UINT32;
+    if (name == "float" || name == "float32")
+        return PlyType::FLOAT32;
+    if (name == "double" || name == "float64")
+        return PlyType::FLOAT64;
+    return std::nullopt;
+}
+
+static constexpr uint32_t get_ply_type_size(const PlyType type)
+{
+    switch (type)
+    {
+    case PlyType::INT8:
+    case PlyType::UINT8:
+        return 1;
+    case PlyType::INT16:
+    case PlyType::UINT16:
+        return 2;
+    case PlyType::INT32:
+    case PlyType::UINT32:
+    case PlyType::FLOAT32:
+        return 4;
+    case PlyType::FLOAT64:
+        return 8;
+    }
+    return 0;
+}
+
+template <typename T>
+static double read_ply_value(const char* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return static_cast<double>(value);
+}
+
+// Binary values are read in the byte order of the host, which matches
+// little endian files on all supported platforms.
+static double read_ply_value(const char* data, const PlyType type)
+{
+    switch (type)
+    {
+    case PlyType::INT8:
+        return read_ply_value<int8_t>(data);
+    case PlyType::UINT8:
+        return read_ply_value<uint8_t>(data);
+    case PlyType::INT16:
+        return read_ply_value<int16_t>(data);
+    case PlyType::UINT16:
+        return read_ply_value<uint16_t>(data);
+    case PlyType::INT32:
+        return read_ply_value<int32_t>(data);
+    case PlyType::UINT32:
+        return read_ply_value<uint32_t>(data);
+    case PlyType::FLOAT32:
+        return read_ply_value<float>(data);
+    case PlyType::FLOAT64:
+        return read_ply_value<double>(data);
+    }
+    return 0.0;
+}
+
+// Floating point colors are in [0, 1], integer colors in [0, 255].
+static uint32_t to_color_channel(const double value, const PlyType type)
+{
+    const auto is_float = type == PlyType::FLOAT32 || type == PlyType::FLOAT64;
+    const auto scaled = is_float ? value * 255.0 : value;
+    return static_cast<uint32_t>(std::clamp(std::round(scaled), 0.0, 255.0));
+}
+
+// Reads the vertex positions and colors of a PLY file. The vertices must be
+// the first element of the file, and other elements are ignored.
+static std::vector<PointCloudVertex> read_ply(
+    const std::filesystem::path& filepath)
+{
+    std::ifstream input_stream(filepath, std::ios::in | std::ios::binary);
+    std::string line;
+    if (!std::getline(input_stream, line) || line.rfind("ply", 0) != 0)
+    {
+        PINE_CORE_ERROR("Could not read PLY file '{0}'", filepath.string());
+        return {};
+    }
+
+    auto format = PlyFormat::ASCII;
+    uint32_t vertex_count = 0;
+    uint32_t element_count = 0;
+    bool is_vertex_element = false;
+    std::vector<PlyProperty> properties;
+    uint32_t stride = 0;
+    while (std::getline(input_stream, line))
+    {
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (keyword == "end_header")
+        {
+            break;
+        }
+
+        if (keyword == "format")
+        {
+            std::string name;
+            tokens >> name;
+            if (name == "binary_little_endian")
+            {
+                format = PlyFormat::BINARY_LITTLE_ENDIAN;
+            }
+            else if (name != "ascii")
+            {
+                PINE_CORE_ERROR("Unsupported PLY format '{0}' in '{1}'",
+                    name,
+                    filepath.string());
+                return {};
+            }
+        }
+        else if (keyword == "element")
+        {
+            std::string name;
+            uint32_t count = 0;
+            tokens >> name >> count;
+            is_vertex_element = name == "vertex";
+            if (is_vertex_element && element_count > 0)
+            {
+                PINE_CORE_ERROR("PLY file '{0}' does not start with vertices.",
+                    filepath.string());
+                return {};
+            }
+            if (is_vertex_element)
+            {
+                vertex_count = count;
+            }
+            element_count++;
+        }
+        else if (keyword == "property" && is_vertex_element)
+        {
+            std::string type_name;
+            std::string name;
+            tokens >> type_name >> name;
+            const auto type = parse_ply_type(type_name);
+            if (!type)
+            {
+                PINE_CORE_ERROR("Unsupported PLY vertex property '{0}' in "
+                                "'{1}'",
+                    type_name,
+                    filepath.string());
+                return {};
+            }
+            properties.push_back({name, *type, stride});
+            stride += get_ply_type_size(*type);
+        }
+    }
+
+    const auto find_property = [&properties](const std::string& name)
+    {
+        const auto it = std::find_if(properties.begin(),
+            properties.end(),
+            [&name](const PlyProperty& property)
+            { return property.name == name; });
+        return static_cast<size_t>(it - properties.begin());
+    };
+    const std::array<size_t, 3> position_indices = {
+        find_property("x"),
+        find_property("y"),
+        find_property("z"),
+    };
+    const std::array<size_t, 4> color_indices = {
+        find_property("red"),
+        find_property("green"),
+        find_property("blue"),
+        find_property("alpha"),
+    };
+    if (std::any_of(position_indices.begin(),
+            position_indices.end(),
+            [&properties](const size_t index)
+            { return index == properties.size(); }))
+    {
+        PINE_CORE_ERROR("PLY file '{0}' has no vertex positions.",
+            filepath.string());
+        return {};
+    }
+
+    std::vector<double> values(properties.size());
+    const auto to_vertex = [&]()
+    {
+        PointCloudVertex vertex;
+        for (size_t axis = 0; axis < position_indices.size(); axis++)
+        {
+            vertex.position[static_cast<int>(axis)] =
+                static_cast<float>(values[position_indices[axis]]);
+        }
+        for (size_t channel = 0; channel < color_indices.size(); channel++)
+        {
+            const auto index = color_indices[channel];
+            if (index < properties.size())
+            {
+                const auto shift = static_cast<uint32_t>(channel * 8);
+                vertex.color &= ~(0xffu << shift);
+                vertex.color |=
+                    to_color_channel(values[index], properties[index].type)
+                    << shift;
+            }
+        }
+        return vertex;
+    };
+
+    // The count is read from the file, so it is checked against the size of
+    // the body before allocating. ASCII values take at least one byte each.
+    std::error_code error;
+    const auto file_size = std::filesystem::file_size(filepath, error);
+    const auto header_size = static_cast<std::streamoff>(input_stream.tellg());
+    const auto vertex_size = format == PlyFormat::BINARY_LITTLE_ENDIAN
+        ? static_cast<uint64_t>(stride)
+        : properties.size();
+    if (error || header_size < 0
+        || static_cast<uint64_t>(vertex_count) * vertex_size
+            > file_size - static_cast<uint64_t>(header_size))
+    {
+        PINE_CORE_ERROR("Truncated PLY file '{0}'", filepath.string());
+        return {};
+    }
+
+    std::vector<PointCloudVertex> vertices;
+    vertices.reserve(vertex_count);
+    if (format == PlyFormat::BINARY_LITTLE_ENDIAN)
+    {
+        const auto size = static_cast<size_t>(vertex_count) * stride;
+        std::vector<char> body(size);
+        input_stream.read(body.data(), static_cast<std::streamsize>(size));
+        if (static_cast<size_t>(input_stream.gcount()) != size)
+        {
+            PINE_CORE_ERROR("Truncated PLY file '{0}'", filepath.string());
+            return {};
+        }
+
+        for (uint32_t vertex = 0; vertex < vertex_count; vertex++)
+        {
+            const auto* data =
+                body.data() + static_cast<size_t>(vertex) * stride;
+            for (size_t index = 0; index < properties.size(); index++)
+            {
+                const auto& property = properties[index];
+                values[index] =
+                    read_ply_value(data + property.offset, property.type);
+            }
+            vertices.push_back(to_vertex());
+        }
+    }
+    else
+    {
+        for (uint32_t vertex = 0; vertex < vertex_count; vertex++)
+        {
+            for (auto& value : values)
+            {
+                input_stream >> value;
+            }
+            if (!input_stream)
+            {
+                PINE_CORE_ERROR("Truncated PLY file '{0}'", filepath.string());
+                return {};
+            }
+            vertices.push_back(to_vertex());
+        }
+    }
+
+    return vertices;
+}
+
+struct OctreeTask
+{
+    Vec3 min = {};
+    float size = 0.0f;
+    uint32_t parent = PointCloud::invalid_node;
+    std::vector<PointCloudVertex> points = {};
+};
+
+std::shared_ptr<PointCloud> PointCloud::load(
+    const std::filesystem::path& filepath, JobSystem& job_system)
+{
+    auto point_cloud = std::make_shared<PointCloud>();
+    point_cloud->m_loading.store(true, std::memory_order_release);
+    job_system.execute(
+        [point_cloud, filepath]()
+        {
+            auto points = read_ply(filepath);
+            if (!points.empty())
+            {
+                point_cloud->build(std::move(points));
+                PINE_CORE_INFO("Loaded point cloud '{0}' with {1} points in "
+                               "{2} nodes.",
+                    filepath.string(),
+                    point_cloud->m_points.size(),
+                    point_cloud->m_nodes.size());
+                point_cloud->m_loaded.store(true, std::memory_order_release);
+            }
+            point_cloud->m_loading.store(false, std::memory_order_release);
+        });
+    return point_cloud;
+}
+
+void PointCloud::build(std::vector<PointCloudVertex> points)
+{
+    // The root is the bounding cube of the points, so that the cells of the
+    // sampling grids are cubes as well.
+    auto min = points.front().position;
+    auto max = points.front().position;
+    for (const auto& point : points)
+    {
+        for (int axis = 0; axis < 3; axis++)
+        {
+            min[axis] = std::min(min[axis], point.position[axis]);
+            max[axis] = std::max(max[axis], point.position[axis]);
+        }
+    }
+    const auto extent = max - min;
+    const auto size =
+        std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-6f));
+
+    m_points.reserve(points.size());
+
+    // The tree is built level by level, which sorts the nodes by level.
+    std::vector<OctreeTask> level;
+    level.push_back({min, size, invalid_node, std::move(points)});
+    std::vector<bool> occupied_cells;
+    for (uint32_t depth = 0; !level.empty(); depth++)
+    {
+        m_level_offsets.push_back(static_cast<uint32_t>(m_nodes.size()));
+
+        std::vector<OctreeTask> next_level;
+        for (auto& task : level)
+        {
+            const auto index = static_cast<uint32_t>(m_nodes.size());
+
+            PointCloudNode node;
+            node.min = task.min;
+            node.max = task.min + Vec3(task.size);
+            node.spacing = task.size / static_cast<float>(grid_resolution);
+            node.parent = task.parent;
+            node.first_point = static_cast<uint32_t>(m_points.size());
+
+            if (task.points.size() <= max_leaf_points
+                || depth + 1 >= max_depth)
+            {
+                m_points.insert(m_points.end(),
+                    task.points.begin(),
+                    task.points.end());
+            }
+            else
+            {
+                const auto to_cell = [](const float coordinate)
+                {
+                    const auto resolution =
+                        static_cast<float>(grid_resolution);
+                    return static_cast<uint32_t>(std::clamp(
+                        coordinate * resolution,
+                        0.0f,
+                        resolution - 1.0f));
+                };
+
+                // The first point in each cell stays in the node.
+                occupied_cells.assign(
+                    grid_resolution * grid_resolution * grid_resolution,
+                    false);
+                std::array<std::vector<PointCloudVertex>, 8> children;
+                for (const auto& point : task.points)
+                {
+                    const auto local = (point.position - task.min) / task.size;
+                    const auto cell = (to_cell(local.z) * grid_resolution
+                                          + to_cell(local.y))
+                            * grid_resolution
+                        + to_cell(local.x);
+                    if (!occupied_cells[cell])
+                    {
+                        occupied_cells[cell] = true;
+                        m_points.push_back(point);
+                        continue;
+                    }
+
+                    const auto octant = (local.x >= 0.5f ? 1u : 0u)
+                        | (local.y >= 0.5f ? 2u : 0u)
+                        | (local.z >= 0.5f ? 4u : 0u);
+                    children[octant].push_back(point);
+                }
+
+                const auto half_size = task.size * 0.5f;
+                for (uint32_t octant = 0; octant < children.size(); octant++)
+                {
+                    if (children[octant].empty())
+                    {
+                        continue;
+                    }
+
+                    const auto offset = Vec3((octant & 1u) ? half_size : 0.0f,
+                        (octant & 2u) ? half_size : 0.0f,
+                        (octant & 4u) ? half_size : 0.0f);
+                    next_level.push_back({task.min + offset,
+                        half_size,
+                        index,
+                        std::move(children[octant])});
+                }
+            }
+
+            node.point_count =
+                static_cast<uint32_t>(m_points.size()) - node.first_point;
+            m_nodes.push_back(node);
+
+            // Frees the points of the task, as they have been sorted.
+            task.points = {};
+        }
+
+        level = std::move(next_level);
+    }
+    m_level_offsets.push_back(static_cast<uint32_t>(m_nodes.size()));
+}
+
+} // namespace pine
@@ -0,0 +1,203 @@
+#include "pine/renderer/point_cloud_renderer.hpp"
+
+#include <limits>
+
+#include "pine/pch.hpp"
+#include "pine/renderer/render_command.hpp"
+#include "pine/renderer/renderer.hpp"
+
+namespace pine
+{
+
+static constexpr uint32_t s_no_points = 0;
+
+PointCloudRenderData PointCloudRenderer::init(
+    const std::shared_ptr<Shader>& point_shader,
+    const std::shared_ptr<Shader>& cull_shader)
+{
+    PointCloudRenderData data;
+
+    // The point cloud buffers are created once the size is known.
+    data.buffers = std::make_unique<PointCloudBuffers>();
+    data.counter_buffer = StorageBuffer::create(sizeof(uint32_t),
+        PointCloudRenderCaps::counter_binding);
+
+    data.point_shader = point_shader
+        ? point_shader
+        : Shader::create("resources/shaders/point_cloud_shader.glsl");
+    data.cull_shader = cull_shader
+        ? cull_shader
+        : Shader::create("resources/shaders/point_cloud_cull_shader.glsl");
+
+    return data;
+}
+
+void PointCloudRenderer::shutdown(PointCloudRenderData& data)
+{
+    data.level_offsets.clear();
+    data.statistics = {};
+}
+
+bool PointCloudRenderer::upload_point_cloud(PointCloudRenderData& data,
+    const std::shared_ptr<PointCloud>& point_cloud)
+{
+    if (!point_cloud || !point_cloud->is_loaded())
+    {
+        return false;
+    }
+
+    const auto& points = point_cloud->get_points();
+    const auto& nodes = point_cloud->get_nodes();
+    if (points.empty())
+    {
+        PINE_CORE_ERROR("Cannot upload an empty point cloud.");
+        return false;
+    }
+
+    // Buffer sizes are 32 bit.
+    constexpr auto max_size = std::numeric_limits<uint32_t>::max();
+    if (points.size() > max_size / sizeof(PointCloudVertex)
+        || nodes.size() > max_size / sizeof(PointCloudNode))
+    {
+        PINE_CORE_ERROR("Point cloud of {0} points in {1} nodes is too large "
+                        "for the point cloud buffers.",
+            points.size(),
+            nodes.size());
+        return false;
+    }
+
+    const auto point_count = static_cast<uint32_t>(points.size());
+    const auto node_count = static_cast<uint32_t>(nodes.size());
+
+    // A loaded point cloud does not change, so the copy of the pointer is
+    // enough to keep the data valid for the render thread. The previous
+    // buffers are released by the command, after the commands that use them.
+    RenderCommand::enqueue(
+        [point_cloud, buffers = data.buffers.get(), point_count, node_count]()
+        {
+            const auto point_size =
+                static_cast<uint32_t>(point_count * sizeof(PointCloudVertex));
+            const auto node_size =
+                static_cast<uint32_t>(node_count * sizeof(PointCloudNode));
+            // Smaller than the nodes, so they fit as well.
+            const auto refine_size =
+                static_cast<uint32_t>(node_count * sizeof(uint32_t));
+            const auto command_size = static_cast<uint32_t>(
+                node_count * sizeof(DrawArraysIndirectCommand));
+
+            auto vertex_buffer = VertexBuffer::create(point_size);
+            vertex_buffer->set_layout({
+                {"a_Position", ShaderDataType::Float3},
+                {"a_Color", ShaderDataType::Uint},
+            });
+            vertex_buffer->set_data(point_cloud->get_points().data(),
+                point_size);
+
+            buffers->point_vertex_array = VertexArray::create();
+            buffers->point_vertex_array->set_vertex_buffer(
+                std::move(vertex_buffer));
+
+            buffers->node_buffer = StorageBuffer::create(node_size,
+                PointCloudRenderCaps::node_binding);
+            buffers->node_buffer->set_data(point_cloud->get_nodes().data(),
+                node_size);
+            buffers->refine_buffer = StorageBuffer::create(refine_size,
+                PointCloudRenderCaps::refine_binding);
+            buffers->command_buffer = IndirectBuffer::create(command_size);
+        });
+
+    data.level_offsets = point_cloud->get_level_offsets();
+
+    data.statistics.point_count = point_count;
+    data.statistics.node_count = node_count;
+    data.statistics.level_count = point_cloud->get_level_count();
+
+    return true;
+}
+
+void PointCloudRenderer::begin_scene(PointCloudRenderData& data,
+    const PerspectiveCamera& camera)
+{
+    data.camera_position = camera.get_position();
+    // A length at unit distance covers this fraction of half the viewport
+    // height.
+    data.projection_scale = camera.get_projection_matrix()[1][1];
+
+    data.statistics.draw_calls = 0;
+    data.statistics.dispatch_count = 0;
+}
+
+void PointCloudRenderer::draw_point_cloud(PointCloudRenderData& data)
+{
+    PINE_PROFILE_FUNCTION();
+
+    const auto node_count = data.statistics.node_count;
+    if (node_count == 0)
+    {
+        return;
+    }
+
+    RenderCommand::enqueue(
+        [shader = data.cull_shader.get(),
+            buffers = data.buffers.get(),
+            counter_buffer = data.counter_buffer.get(),
+            camera_position = data.camera_position,
+            projection_scale = data.projection_scale,
+            error_threshold = data.error_threshold,
+            point_budget = data.point_budget]()
+        {
+            counter_buffer->set_data(&s_no_points, sizeof(s_no_points));
+
+            shader->bind();
+            shader->set_float3("u_CameraPosition", camera_position);
+            shader->set_float("u_ProjectionScale", projection_scale);
+            shader->set_float("u_ErrorThreshold", error_threshold);
+            shader->set_int("u_PointBudget", static_cast<int>(point_budget));
+
+            buffers->node_buffer->bind();
+            buffers->refine_buffer->bind();
+            counter_buffer->bind();
+            buffers->command_buffer->bind_base(
+                PointCloudRenderCaps::command_binding);
+        });
+
+    // Each level reads which of its parents were refined by the previous
+    // dispatch, and the coarse levels claim their points from the budget
+    // before the fine ones.
+    for (size_t level = 0; level + 1 < data.level_offsets.size(); level++)
+    {
+        const auto first_node = data.level_offsets[level];
+        const auto level_node_count =
+            data.level_offsets[level + 1] - first_node;
+
+        RenderCommand::enqueue(
+            [shader = data.cull_shader.get(), first_node, level_node_count]()
+            {
+                shader->set_int("u_FirstNode", static_cast<int>(first_node));
+                shader->set_int("u_NodeCount",
+                    static_cast<int>(level_node_count));
+            });
+        RenderCommand::dispatch_compute(
+            (level_node_count + PointCloudRenderCaps::workgroup_size - 1)
+            / PointCloudRenderCaps::workgroup_size);
+        data.statistics.dispatch_count++;
+    }
+
+    // Commands enqueued while executing run immediately, on the buffers
+    // that the previous upload command created.
+    RenderCommand::enqueue(
+        [shader = data.point_shader.get(),
+            buffers = data.buffers.get(),
+            node_count]()
+        {
+            shader->bind();
+            RenderCommand::draw_arrays_indirect(*buffers->point_vertex_array,
+                *buffers->command_buffer,
+                node_count,
+                0,
+                RendererPrimitives::Points);
+        });
+    data.statistics.draw_calls++;
+}
+
+} // namespace pine
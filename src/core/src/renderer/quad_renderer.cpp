@@ -1,6 +1,7 @@
 #include "pine/renderer/quad_renderer.hpp"
 
 #include "pine/pch.hpp"
+#include "pine/renderer/batch_renderer.hpp"
 #include "pine/renderer/buffer.hpp"
 #include "pine/renderer/render_command.hpp"
 #include "pine/renderer/renderer.hpp"
@@ -42,7 +43,7 @@ void update_quad_vertices(QuadRenderData& data, const Mat4& transform,
     data.statistics.quad_count++;
 }
 
-QuadRenderData QuadRenderer::init()
+QuadRenderData QuadRenderer::init(const std::shared_ptr<Shader>& quad_shader)
 {
     QuadRenderData data;
 
@@ -90,7 +91,9 @@ QuadRenderData QuadRenderer::init()
         return samplers;
     }();
 
-    data.quad_shader = Shader::create("resources/shaders/quad_shader.glsl");
+    data.quad_shader = quad_shader
+        ? quad_shader
+        : Shader::create("resources/shaders/quad_shader.glsl");
     data.quad_shader->bind();
     data.quad_shader->set_int_array("u_Textures",
         samplers.data(),
@@ -112,13 +115,8 @@ void QuadRenderer::shutdown(QuadRenderData& data)
     data.texture_slot_index = 1;
 }
 
-void QuadRenderer::begin_scene(QuadRenderData& data,
-    const OrthographicCamera& camera)
+void QuadRenderer::begin_scene(QuadRenderData& data)
 {
-    data.quad_shader->bind();
-    data.quad_shader->set_mat4("u_ViewProjection",
-        camera.calculate_view_projection_matrix());
-
     data.quad_vertex_count = 0;
     data.quad_index_count = 0;
     data.texture_slot_index = 1;
@@ -126,21 +124,37 @@ void QuadRenderer::begin_scene(QuadRenderData& data,
     data.statistics.draw_calls = 0;
     data.statistics.quad_count = 0;
 }
+
+void QuadRenderer::begin_scene(QuadRenderData& data,
+    const OrthographicCamera& camera)
+{
+    Renderer::begin_scene(camera);
+    begin_scene(data);
+}
 void QuadRenderer::end_scene(QuadRenderData& data)
 {
-    auto& vertex_buffer = data.quad_vertex_array->get_vertex_buffer();
-    vertex_buffer.set_data(data.quad_vertices.data(),
-        static_cast<uint32_t>(data.quad_vertex_count * sizeof(QuadVertex)));
+    BatchRenderer::upload(*data.quad_vertex_array,
+        data.quad_vertices.data(),
+        data.quad_vertex_count * sizeof(QuadVertex));
     flush(data);
 }
 
 void QuadRenderer::flush(QuadRenderData& data)
 {
-    for (uint32_t i = 0; i < data.texture_slot_index; i++)
-        data.texture_slots[i]->bind(i);
-
-    RenderCommand::draw_indexed(*data.quad_vertex_array.get(),
-        data.quad_index_count);
+    PINE_PROFILE_FUNCTION();
+
+    // Copies of the texture slots keep the textures alive until the render
+    // thread has drawn the batch.
+    BatchRenderer::draw("QuadRenderer::flush",
+        *data.quad_shader,
+        *data.quad_vertex_array,
+        data.quad_index_count,
+        [textures = data.texture_slots,
+            texture_count = data.texture_slot_index]()
+        {
+            for (uint32_t i = 0; i < texture_count; i++)
+                textures[i]->bind(i);
+        });
 
     data.statistics.draw_calls++;
 }
@@ -7,5 +7,6 @@ namespace pine
 
 std::unique_ptr<RendererAPI> RenderCommand::s_renderer_api =
     RendererAPI::create();
+RenderCommandQueue* RenderCommand::s_command_queue = nullptr;
 
 }
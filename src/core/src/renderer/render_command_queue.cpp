@@ -0,0 +1,41 @@
+#include "pine/renderer/render_command_queue.hpp"
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+static thread_local bool s_executing = false;
+
+RenderCommandQueue::~RenderCommandQueue() { clear(); }
+
+void RenderCommandQueue::execute()
+{
+    PINE_PROFILE_FUNCTION();
+    s_executing = true;
+    for (const auto& command : m_commands)
+    {
+        command.invoke(command.storage, true);
+    }
+    s_executing = false;
+    reset();
+}
+
+void RenderCommandQueue::clear()
+{
+    for (const auto& command : m_commands)
+    {
+        command.invoke(command.storage, false);
+    }
+    reset();
+}
+
+bool RenderCommandQueue::is_executing() { return s_executing; }
+
+void RenderCommandQueue::reset()
+{
+    m_commands.clear();
+    m_arena.reset();
+}
+
+} // namespace pine
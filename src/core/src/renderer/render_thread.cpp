@@ -0,0 +1,96 @@
+#include "pine/renderer/render_thread.hpp"
+
+#include "pine/pch.hpp"
+#include "pine/renderer/render_command.hpp"
+
+namespace pine
+{
+
+RenderThread::RenderThread(GraphicsContext& context) : m_context(context) {}
+
+RenderThread::~RenderThread() { stop(); }
+
+void RenderThread::start()
+{
+    if (is_running())
+    {
+        return;
+    }
+
+    m_stop = false;
+    m_context.release();
+    m_thread = std::thread([this]() { run(); });
+    RenderCommand::set_command_queue(&m_queues[m_record_index]);
+}
+
+void RenderThread::stop()
+{
+    if (!is_running())
+    {
+        return;
+    }
+
+    kick();
+    {
+        std::scoped_lock lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+
+    RenderCommand::set_command_queue(nullptr);
+    m_context.make_current();
+}
+
+void RenderThread::kick()
+{
+    PINE_PROFILE_FUNCTION();
+    {
+        std::unique_lock lock(m_mutex);
+        m_condition.wait(lock, [this]() { return !m_frame_pending; });
+        m_frame_pending = true;
+        m_record_index ^= 1;
+    }
+    RenderCommand::set_command_queue(&m_queues[m_record_index]);
+    m_condition.notify_all();
+}
+
+void RenderThread::wait_idle()
+{
+    std::unique_lock lock(m_mutex);
+    m_condition.wait(lock, [this]() { return !m_frame_pending; });
+}
+
+void RenderThread::run()
+{
+    m_context.make_current();
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock,
+                [this]() { return m_frame_pending || m_stop; });
+            if (!m_frame_pending)
+            {
+                break;
+            }
+        }
+
+        // The main thread only records into the other queue while a frame
+        // is pending.
+        auto& queue = m_queues[m_record_index ^ 1];
+        queue.execute();
+        m_context.swap_buffers();
+
+        {
+            std::scoped_lock lock(m_mutex);
+            m_frame_pending = false;
+        }
+        m_condition.notify_all();
+    }
+
+    m_context.release();
+}
+
+} // namespace pine
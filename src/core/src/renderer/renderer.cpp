@@ -13,29 +13,70 @@ namespace pine
 std::unique_ptr<Renderer::SceneData> Renderer::s_scene_data =
     std::make_unique<Renderer::SceneData>();
 
-void Renderer::init() { RenderCommand::init(); }
+void Renderer::init()
+{
+    RenderCommand::init();
+    s_scene_data->camera_buffer =
+        UniformBuffer::create(sizeof(CameraUniforms), camera_binding);
+}
+
+void Renderer::shutdown() { s_scene_data->camera_buffer.reset(); }
 
 void Renderer::on_window_resize(const uint32_t width, const uint32_t height)
 {
     RenderCommand::set_viewport(0, 0, width, height);
+    s_scene_data->window_size =
+        Vec2(static_cast<float>(width), static_cast<float>(height));
+}
+
+void Renderer::begin_scene(const OrthographicCamera& camera,
+    const Vec2& viewport_size)
+{
+    upload_camera(camera.calculate_view_projection_matrix(), viewport_size);
 }
 
-void Renderer::begin_scene(const OrthographicCamera& camera)
+void Renderer::begin_scene(const PerspectiveCamera& camera,
+    const Vec2& viewport_size)
 {
-    s_scene_data->view_projection_matrix =
-        camera.calculate_view_projection_matrix();
+    upload_camera(camera.calculate_view_projection_matrix(), viewport_size);
 }
 
 void Renderer::end_scene() {}
 
+void Renderer::upload_camera(const Mat4& view_projection,
+    const Vec2& viewport_size)
+{
+    s_scene_data->view_projection_matrix = view_projection;
+
+    CameraUniforms uniforms;
+    uniforms.view_projection = view_projection;
+    uniforms.viewport_size = viewport_size.x > 0.0f && viewport_size.y > 0.0f
+        ? viewport_size
+        : s_scene_data->window_size;
+
+    RenderCommand::enqueue(
+        [buffer = s_scene_data->camera_buffer.get(), uniforms]()
+        { buffer->set_data(&uniforms, sizeof(uniforms)); });
+}
+
 void Renderer::submit(const Shader& shader, const VertexArray& vertex_array,
     const Mat4& transform)
 {
-    shader.bind();
-    shader.set_mat4("u_ViewProjection", s_scene_data->view_projection_matrix);
-    shader.set_mat4("u_Transform", transform);
+    // Longer than the small string buffer, which holds 15 characters in
+    // libstdc++ and MSVC, so constructing it on every call would allocate.
+    static const std::string view_projection_name = "u_ViewProjection";
 
-    vertex_array.bind();
+    RenderCommand::enqueue(
+        [&shader,
+            &vertex_array,
+            view_projection = s_scene_data->view_projection_matrix,
+            transform]()
+        {
+            shader.bind();
+            shader.set_mat4(view_projection_name, view_projection);
+            shader.set_mat4("u_Transform", transform);
+            vertex_array.bind();
+        });
     RenderCommand::draw_indexed(vertex_array);
 }
 
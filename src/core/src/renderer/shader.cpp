@@ -2,7 +2,9 @@
 
 #include "pine/pch.hpp"
 #include "pine/platform/opengl/shader.hpp"
+#include "pine/renderer/render_command.hpp"
 #include "pine/renderer/renderer.hpp"
+#include "pine/utils/file_watcher.hpp"
 
 namespace pine
 {
@@ -42,11 +44,37 @@ std::unique_ptr<Shader> Shader::create(const std::string& name,
     return nullptr;
 }
 
+std::vector<std::unique_ptr<Shader>> Shader::create(
+    const std::vector<std::filesystem::path>& filepaths,
+    JobSystem* job_system)
+{
+    switch (Renderer::get_api())
+    {
+    case RendererAPI::API::None:
+        PINE_CORE_ASSERT(false, "Renderer API None is currently not \
+			supported!");
+        return {};
+    case RendererAPI::API::OpenGL:
+        return OpenGLShader::create_batch(filepaths, job_system);
+    }
+
+    PINE_CORE_ASSERT(false, "Unknown Renderer API.");
+    return {};
+}
+
+ShaderLibrary::ShaderLibrary() = default;
+
+ShaderLibrary::~ShaderLibrary() = default;
+
 void ShaderLibrary::add_shader(const std::string& name,
     const std::shared_ptr<Shader>& shader)
 {
     PINE_CORE_ASSERT(!has_shader(name), "Shader {0} already exists.", name);
     m_shaders[name] = shader;
+    if (m_watcher)
+    {
+        watch_shader(shader);
+    }
 }
 
 void ShaderLibrary::add_shader(const std::shared_ptr<Shader>& shader)
@@ -72,6 +100,25 @@ bool ShaderLibrary::load_shader(const std::string& filepath)
     return shader ? true : false;
 }
 
+bool ShaderLibrary::load_shaders(const std::vector<std::string>& filepaths,
+    JobSystem* job_system)
+{
+    const std::vector<std::filesystem::path> paths(filepaths.begin(),
+        filepaths.end());
+    auto shaders = Shader::create(paths, job_system);
+    auto success = true;
+    for (auto& shader : shaders)
+    {
+        if (!shader)
+        {
+            success = false;
+            continue;
+        }
+        add_shader(std::shared_ptr<Shader>(std::move(shader)));
+    }
+    return success;
+}
+
 const std::shared_ptr<Shader>& ShaderLibrary::get_shader(
     const std::string& name) const
 {
@@ -84,4 +131,65 @@ bool ShaderLibrary::has_shader(const std::string& name) const
     return m_shaders.find(name) != m_shaders.end();
 }
 
+void ShaderLibrary::set_hot_reload(const bool enabled)
+{
+    if (enabled == is_hot_reload_enabled())
+    {
+        return;
+    }
+
+    if (!enabled)
+    {
+        m_watcher.reset();
+        return;
+    }
+
+    m_watcher = std::make_unique<FileWatcher>();
+    for (const auto& [name, shader] : m_shaders)
+    {
+        watch_shader(shader);
+    }
+}
+
+void ShaderLibrary::update_hot_reload()
+{
+    std::scoped_lock lock(m_reload_mutex);
+    for (const auto& shader : m_reloading)
+    {
+        RenderCommand::enqueue([shader]() { shader->update_reload(); });
+    }
+
+    // With a render thread, the reloads finish in a later frame.
+    m_reloading.erase(std::remove_if(m_reloading.begin(),
+                          m_reloading.end(),
+                          [](const auto& shader)
+                          { return !shader->is_reloading(); }),
+        m_reloading.end());
+}
+
+void ShaderLibrary::watch_shader(const std::shared_ptr<Shader>& shader)
+{
+    if (shader->get_filepath().empty())
+    {
+        return;
+    }
+
+    // The callback runs on the watcher thread. It owns a reference to the
+    // shader, but uses the reload mutex and list of the library, which must
+    // outlive the watcher.
+    m_watcher->watch(shader->get_filepath(),
+        [this, shader](const std::filesystem::path& filepath)
+        {
+            PINE_CORE_INFO("Reloading shader {0}.", filepath.string());
+            shader->reload_source();
+
+            std::scoped_lock lock(m_reload_mutex);
+            if (std::find(m_reloading.begin(), m_reloading.end(), shader)
+                == m_reloading.end())
+            {
+                m_reloading.push_back(shader);
+            }
+        });
+}
+
 } // namespace pine
@@ -0,0 +1,184 @@
+#include "pine/renderer/text_renderer.hpp"
+
+#include "pine/pch.hpp"
+#include "pine/renderer/batch_renderer.hpp"
+#include "pine/renderer/render_command.hpp"
+#include "pine/renderer/renderer.hpp"
+
+namespace pine
+{
+
+static constexpr bool is_glyph_within_capabilities(const TextRenderData& data)
+{
+    return data.text_vertex_count + TextRenderCaps::vertices_per_glyph
+        <= TextRenderCaps::max_vertices;
+}
+
+TextRenderData TextRenderer::init(const std::shared_ptr<Shader>& text_shader)
+{
+    TextRenderData data;
+
+    auto vertex_buffer =
+        VertexBuffer::create(TextRenderCaps::max_vertices * sizeof(TextVertex));
+    vertex_buffer->set_layout({
+        {"a_Position", ShaderDataType::Float3},
+        {"a_Color", ShaderDataType::Float4},
+        {"a_TexCoord", ShaderDataType::Float2},
+    });
+
+    data.text_vertex_array = VertexArray::create();
+    data.text_vertex_array->set_vertex_buffer(std::move(vertex_buffer));
+
+    const auto text_indices = create_quad_indices(TextRenderCaps::max_glyphs);
+    data.text_vertex_array->set_index_buffer(
+        IndexBuffer::create(text_indices.data(),
+            static_cast<uint32_t>(text_indices.size())));
+
+    data.text_shader = text_shader
+        ? text_shader
+        : Shader::create("resources/shaders/text_shader.glsl");
+
+    return data;
+}
+
+void TextRenderer::shutdown(TextRenderData& data)
+{
+    data.text_vertex_count = 0;
+    data.text_index_count = 0;
+    data.font_atlas.reset();
+}
+
+void TextRenderer::begin_scene(TextRenderData& data)
+{
+    data.text_vertex_count = 0;
+    data.text_index_count = 0;
+
+    data.statistics.draw_calls = 0;
+    data.statistics.glyph_count = 0;
+}
+
+void TextRenderer::end_scene(TextRenderData& data)
+{
+    if (data.text_index_count == 0)
+    {
+        return;
+    }
+
+    BatchRenderer::upload(*data.text_vertex_array,
+        data.text_vertices.data(),
+        data.text_vertex_count * sizeof(TextVertex));
+    flush(data);
+}
+
+void TextRenderer::flush(TextRenderData& data)
+{
+    PINE_PROFILE_FUNCTION();
+
+    // The copy of the atlas keeps it alive until the render thread has drawn
+    // the batch.
+    BatchRenderer::draw("TextRenderer::flush",
+        *data.text_shader,
+        *data.text_vertex_array,
+        data.text_index_count,
+        [atlas = data.font_atlas]() { atlas->bind(0); });
+
+    data.statistics.draw_calls++;
+}
+
+void TextRenderer::flush_and_reset(TextRenderData& data)
+{
+    end_scene(data);
+    data.text_vertex_count = 0;
+    data.text_index_count = 0;
+}
+
+void TextRenderer::draw_text(TextRenderData& data, const Font& font,
+    const std::string_view text, const Vec2& position, const float size,
+    const Vec4& color)
+{
+    draw_text(data, font, text, {position.x, position.y, 0.0f}, size, color);
+}
+
+void TextRenderer::draw_text(TextRenderData& data, const Font& font,
+    const std::string_view text, const Vec3& position, const float size,
+    const Vec4& color)
+{
+    const Mat4 transform = translate(Mat4(1.0f), position)
+        * scale(Mat4(1.0f), Vec3(size, size, 1.0f));
+
+    draw_text(data, font, text, transform, color);
+}
+
+void TextRenderer::draw_text(TextRenderData& data, const Font& font,
+    const std::string_view text, const Mat4& transform, const Vec4& color)
+{
+    if (!font.is_loaded())
+    {
+        return;
+    }
+
+    if (data.font_atlas != font.get_atlas())
+    {
+        if (data.text_index_count > 0)
+        {
+            flush_and_reset(data);
+        }
+        data.font_atlas = font.get_atlas();
+    }
+
+    auto pen = Vec2(0.0f, -font.get_ascent());
+    for (size_t index = 0; index < text.size(); index++)
+    {
+        const auto character = text[index];
+        if (character == '\n')
+        {
+            pen = Vec2(0.0f, pen.y - font.get_line_spacing());
+            continue;
+        }
+
+        if (!is_glyph_within_capabilities(data))
+        {
+            flush_and_reset(data);
+        }
+
+        const auto& glyph = font.get_glyph(character);
+        if (glyph.max.x > glyph.min.x)
+        {
+            const std::array<Vec2, TextRenderCaps::vertices_per_glyph> corners =
+                {{
+                    {glyph.min.x, glyph.min.y},
+                    {glyph.max.x, glyph.min.y},
+                    {glyph.max.x, glyph.max.y},
+                    {glyph.min.x, glyph.max.y},
+                }};
+            const std::array<Vec2, TextRenderCaps::vertices_per_glyph>
+                texture_coordinates = {{
+                    {glyph.texture_min.x, glyph.texture_min.y},
+                    {glyph.texture_max.x, glyph.texture_min.y},
+                    {glyph.texture_max.x, glyph.texture_max.y},
+                    {glyph.texture_min.x, glyph.texture_max.y},
+                }};
+
+            for (uint32_t i = 0; i < TextRenderCaps::vertices_per_glyph; i++)
+            {
+                auto& vertex = data.text_vertices[data.text_vertex_count++];
+                const auto corner = pen + corners[i];
+                vertex.position =
+                    transform * Vec4(corner.x, corner.y, 0.0f, 1.0f);
+                vertex.color = color;
+                vertex.texture_coordinates = texture_coordinates[i];
+            }
+
+            data.text_index_count += TextRenderCaps::indices_per_glyph;
+            data.statistics.glyph_count++;
+        }
+
+        pen.x += glyph.advance;
+        if (index + 1 < text.size())
+        {
+            pen.x += font.get_kerning(character, text[index + 1]);
+        }
+    }
+}
+
+} // namespace pine
@@ -1,12 +1,92 @@
 #include "pine/renderer/texture.hpp"
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "pine/pch.hpp"
 #include "pine/platform/opengl/texture.hpp"
+#include "pine/renderer/render_command.hpp"
 #include "pine/renderer/renderer.hpp"
+#include "pine/renderer/texture_cache.hpp"
+#include "pine/utils/file_watcher.hpp"
 
 namespace pine
 {
 
+// Textures that were created from files, for hot reloading.
+struct TextureReloadState
+{
+    std::mutex mutex;
+    std::unordered_map<Texture2D*, std::string> textures;
+
+    std::unique_ptr<FileWatcher> watcher;
+    std::unordered_map<std::string, FileWatcher::WatchID> watches;
+
+    // Decoded on the watcher thread, waiting for upload.
+    std::vector<std::pair<std::string, std::shared_ptr<const Image>>> images;
+};
+
+static TextureReloadState s_reload_state;
+
+// Requires the lock.
+static void watch_texture_file(const std::string& filepath)
+{
+    auto& state = s_reload_state;
+    if (!state.watcher || state.watches.count(filepath))
+    {
+        return;
+    }
+
+    state.watches[filepath] = state.watcher->watch(filepath,
+        [filepath](const std::filesystem::path&)
+        {
+            PINE_CORE_INFO("Reloading texture {0}.", filepath);
+            auto image = std::make_shared<const Image>(read_image(filepath));
+            if (image->get_buffer().empty())
+            {
+                PINE_CORE_ERROR("Reloading texture {0} failed, keeping the "
+                                "current image.",
+                    filepath);
+                return;
+            }
+
+            std::scoped_lock lock(s_reload_state.mutex);
+            s_reload_state.images.emplace_back(filepath, std::move(image));
+        });
+}
+
+static void register_texture(Texture2D* texture,
+    const std::filesystem::path& filepath)
+{
+    std::scoped_lock lock(s_reload_state.mutex);
+    s_reload_state.textures[texture] = filepath.string();
+    watch_texture_file(filepath.string());
+}
+
+// The textures are looked up when the upload executes rather than when it is
+// enqueued, since they may be destroyed in between.
+static void upload_reloaded_image(const std::string& filepath,
+    const Image& image)
+{
+    std::scoped_lock lock(s_reload_state.mutex);
+    for (const auto& [texture, texture_filepath] : s_reload_state.textures)
+    {
+        if (texture_filepath == filepath)
+        {
+            texture->set_image(image);
+        }
+    }
+}
+
+Texture2D::~Texture2D()
+{
+    std::scoped_lock lock(s_reload_state.mutex);
+    s_reload_state.textures.erase(this);
+}
+
 std::unique_ptr<Texture2D> Texture2D::create(
     const std::filesystem::path& filepath)
 {
@@ -17,14 +97,22 @@ std::unique_ptr<Texture2D> Texture2D::create(
 			supported!");
         return nullptr;
     case RendererAPI::API::OpenGL:
-        return std::make_unique<OpenGLTexture2D>(filepath);
+    {
+        const auto cached = find_cached_texture(filepath);
+        auto texture = cached
+            ? std::make_unique<OpenGLTexture2D>(*cached, filepath)
+            : std::make_unique<OpenGLTexture2D>(filepath);
+        register_texture(texture.get(), filepath);
+        return texture;
+    }
     }
 
     PINE_CORE_ASSERT(false, "Unknown Renderer API.");
     return nullptr;
 }
 
-std::unique_ptr<Texture2D> Texture2D::create(const Image& image)
+std::unique_ptr<Texture2D> Texture2D::create(const Image& image,
+    const TextureFilter filter)
 {
     switch (Renderer::get_api())
     {
@@ -33,11 +121,69 @@ std::unique_ptr<Texture2D> Texture2D::create(const Image& image)
             supported!");
         return nullptr;
     case RendererAPI::API::OpenGL:
-        return std::make_unique<OpenGLTexture2D>(image);
+        return std::make_unique<OpenGLTexture2D>(image, filter);
     }
 
     PINE_CORE_ASSERT(false, "Unknown Renderer API.");
     return nullptr;
 }
 
+std::unique_ptr<IndexTexture2D> IndexTexture2D::create(const uint32_t width,
+    const uint32_t height)
+{
+    switch (Renderer::get_api())
+    {
+    case RendererAPI::API::None:
+        PINE_CORE_ASSERT(false, "Renderer API None is currently not \
+            supported!");
+        return nullptr;
+    case RendererAPI::API::OpenGL:
+        return std::make_unique<OpenGLIndexTexture2D>(width, height);
+    }
+
+    PINE_CORE_ASSERT(false, "Unknown Renderer API.");
+    return nullptr;
+}
+
+void Texture2D::set_hot_reload(const bool enabled)
+{
+    // The watcher is destroyed without the lock, as its callbacks take it.
+    std::unique_ptr<FileWatcher> watcher;
+    {
+        std::scoped_lock lock(s_reload_state.mutex);
+        auto& state = s_reload_state;
+        if (enabled == (state.watcher != nullptr))
+        {
+            return;
+        }
+
+        std::swap(watcher, state.watcher);
+        state.watches.clear();
+        if (enabled)
+        {
+            state.watcher = std::make_unique<FileWatcher>();
+            for (const auto& [texture, filepath] : state.textures)
+            {
+                watch_texture_file(filepath);
+            }
+        }
+    }
+}
+
+void Texture2D::update_hot_reload()
+{
+    decltype(s_reload_state.images) images;
+    {
+        std::scoped_lock lock(s_reload_state.mutex);
+        std::swap(images, s_reload_state.images);
+    }
+
+    for (auto& [filepath, image] : images)
+    {
+        RenderCommand::enqueue(
+            [filepath = std::move(filepath), image = std::move(image)]()
+            { upload_reloaded_image(filepath, *image); });
+    }
+}
+
 } // namespace pine
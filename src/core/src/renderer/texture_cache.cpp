@@ -0,0 +1,364 @@
+#include "pine/renderer/texture_cache.hpp"
+
+#include <cstring>
+#include <fstream>
+
+#if defined(PINE_PLATFORM_LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "pine/core/common.hpp"
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+static std::filesystem::path s_texture_cache_directory =
+    "resources/cache/textures";
+
+static constexpr uint64_t s_data_alignment = 16;
+
+static constexpr uint64_t align_offset(const uint64_t offset)
+{
+    return (offset + s_data_alignment - 1) & ~(s_data_alignment - 1);
+}
+
+static constexpr uint32_t get_channel_count(const TextureFormat format)
+{
+    switch (format)
+    {
+    case TextureFormat::UNKNOWN:
+        return 0;
+    case TextureFormat::RED:
+        return 1;
+    case TextureFormat::RG:
+        return 2;
+    case TextureFormat::RGB:
+        return 3;
+    case TextureFormat::BGR:
+        return 3;
+    case TextureFormat::RGBA:
+        return 4;
+    case TextureFormat::BGRA:
+        return 4;
+    }
+    return 0;
+}
+
+// Halves an 8-bit image with a 2x2 box filter. Odd edges are clamped.
+static std::vector<uint8_t> downsample(const std::vector<uint8_t>& source,
+    const uint32_t width, const uint32_t height, const uint32_t channels,
+    const uint32_t target_width, const uint32_t target_height)
+{
+    std::vector<uint8_t> result(
+        static_cast<size_t>(target_width) * target_height * channels);
+
+    for (uint32_t y = 0; y < target_height; y++)
+    {
+        const auto y0 = std::min(y * 2, height - 1);
+        const auto y1 = std::min(y * 2 + 1, height - 1);
+        for (uint32_t x = 0; x < target_width; x++)
+        {
+            const auto x0 = std::min(x * 2, width - 1);
+            const auto x1 = std::min(x * 2 + 1, width - 1);
+            for (uint32_t c = 0; c < channels; c++)
+            {
+                const auto sum = source[(y0 * width + x0) * channels + c]
+                    + source[(y0 * width + x1) * channels + c]
+                    + source[(y1 * width + x0) * channels + c]
+                    + source[(y1 * width + x1) * channels + c];
+                result[(y * target_width + x) * channels + c] =
+                    static_cast<uint8_t>((sum + 2) / 4);
+            }
+        }
+    }
+
+    return result;
+}
+
+MappedTextureFile::~MappedTextureFile()
+{
+#if defined(PINE_PLATFORM_LINUX)
+    if (m_data)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+}
+
+MappedTextureFile::MappedTextureFile(MappedTextureFile&& other) noexcept
+    : m_data(other.m_data), m_size(other.m_size)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+}
+
+MappedTextureFile& MappedTextureFile::operator=(
+    MappedTextureFile&& other) noexcept
+{
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+    return *this;
+}
+
+std::optional<MappedTextureFile> MappedTextureFile::open(
+    const std::filesystem::path& filepath)
+{
+#if defined(PINE_PLATFORM_LINUX)
+    const auto descriptor = ::open(filepath.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        return std::nullopt;
+    }
+
+    struct stat file_status = {};
+    if (fstat(descriptor, &file_status) != 0
+        || static_cast<uint64_t>(file_status.st_size)
+            < sizeof(TextureCacheHeader))
+    {
+        close(descriptor);
+        return std::nullopt;
+    }
+
+    const auto size = static_cast<uint64_t>(file_status.st_size);
+    void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (address == MAP_FAILED)
+    {
+        PINE_CORE_WARN("Could not map texture cache file '{0}'",
+            filepath.string());
+        return std::nullopt;
+    }
+
+    MappedTextureFile file;
+    file.m_data = static_cast<const uint8_t*>(address);
+    file.m_size = size;
+
+    // Validate the header and the mip table before handing out pointers.
+    const auto& header = file.get_header();
+    if (header.magic != TextureCacheHeader::file_magic
+        || header.version != TextureCacheHeader::file_version
+        || header.mip_count == 0)
+    {
+        PINE_CORE_WARN("Invalid texture cache file '{0}'", filepath.string());
+        return std::nullopt;
+    }
+
+    const auto table_end = sizeof(TextureCacheHeader)
+        + header.mip_count * sizeof(TextureCacheMip);
+    if (table_end > size)
+    {
+        PINE_CORE_WARN("Truncated texture cache file '{0}'", filepath.string());
+        return std::nullopt;
+    }
+
+    for (uint32_t level = 0; level < header.mip_count; level++)
+    {
+        const auto& mip = file.get_mip(level);
+        if (mip.offset < table_end || mip.offset + mip.size > size)
+        {
+            PINE_CORE_WARN("Truncated texture cache file '{0}'",
+                filepath.string());
+            return std::nullopt;
+        }
+    }
+
+    return file;
+#else
+    return std::nullopt;
+#endif
+}
+
+const TextureCacheHeader& MappedTextureFile::get_header() const
+{
+    return *reinterpret_cast<const TextureCacheHeader*>(m_data);
+}
+
+const TextureCacheMip& MappedTextureFile::get_mip(const uint32_t level) const
+{
+    PINE_CORE_ASSERT(level < get_header().mip_count, "Invalid mip level.");
+    const auto table = m_data + sizeof(TextureCacheHeader);
+    return reinterpret_cast<const TextureCacheMip*>(table)[level];
+}
+
+const uint8_t* MappedTextureFile::get_mip_data(const uint32_t level) const
+{
+    return m_data + get_mip(level).offset;
+}
+
+uint64_t MappedTextureFile::get_data_size() const
+{
+    const auto& header = get_header();
+    const auto& last = get_mip(header.mip_count - 1);
+    return last.offset + last.size - get_mip(0).offset;
+}
+
+const uint8_t* MappedTextureFile::get_data() const { return get_mip_data(0); }
+
+uint64_t hash_file_contents(const std::filesystem::path& filepath)
+{
+    static constexpr uint64_t fnv_offset = 14695981039346656037ull;
+    static constexpr uint64_t fnv_prime = 1099511628211ull;
+
+    std::ifstream input_stream(filepath, std::ios::in | std::ios::binary);
+    if (!input_stream)
+    {
+        return 0;
+    }
+
+    uint64_t hash = fnv_offset;
+    std::array<char, 64 * 1024> chunk;
+    while (input_stream)
+    {
+        input_stream.read(chunk.data(), chunk.size());
+        const auto count = static_cast<size_t>(input_stream.gcount());
+        for (size_t i = 0; i < count; i++)
+        {
+            hash ^= static_cast<uint8_t>(chunk[i]);
+            hash *= fnv_prime;
+        }
+    }
+    return hash;
+}
+
+void set_texture_cache_directory(const std::filesystem::path& directory)
+{
+    s_texture_cache_directory = directory;
+}
+
+const std::filesystem::path& get_texture_cache_directory()
+{
+    return s_texture_cache_directory;
+}
+
+std::filesystem::path get_texture_cache_path(const uint64_t content_hash)
+{
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << content_hash
+         << ".ptex";
+    return s_texture_cache_directory / name.str();
+}
+
+std::optional<MappedTextureFile> find_cached_texture(
+    const std::filesystem::path& source_path)
+{
+    if (s_texture_cache_directory.empty()
+        || !std::filesystem::is_directory(s_texture_cache_directory))
+    {
+        return std::nullopt;
+    }
+
+    const auto content_hash = hash_file_contents(source_path);
+    if (content_hash == 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto cache_path = get_texture_cache_path(content_hash);
+    if (!std::filesystem::exists(cache_path))
+    {
+        return std::nullopt;
+    }
+
+    auto file = MappedTextureFile::open(cache_path);
+    if (file && file->get_header().content_hash != content_hash)
+    {
+        return std::nullopt;
+    }
+    return file;
+}
+
+bool write_texture_cache(const std::filesystem::path& filepath,
+    const Image& image, const uint64_t content_hash, const bool generate_mips)
+{
+    const auto format = static_cast<TextureFormat>(image.get_format());
+    const auto channels = get_channel_count(format);
+    if (channels == 0 || image.get_width() == 0 || image.get_height() == 0)
+    {
+        PINE_CORE_ERROR("Cannot cache image with unknown format.");
+        return false;
+    }
+
+    // Build the mip chain in memory. Level 0 is the source image.
+    std::vector<std::vector<uint8_t>> levels;
+    std::vector<TextureCacheMip> mips;
+    levels.emplace_back(image.get_buffer().begin(), image.get_buffer().end());
+    mips.push_back({image.get_width(), image.get_height(), 0, 0});
+
+    while (generate_mips && (mips.back().width > 1 || mips.back().height > 1))
+    {
+        const auto& previous = mips.back();
+        const auto width = std::max(previous.width / 2, 1u);
+        const auto height = std::max(previous.height / 2, 1u);
+        levels.push_back(downsample(levels.back(),
+            previous.width,
+            previous.height,
+            channels,
+            width,
+            height));
+        mips.push_back({width, height, 0, 0});
+    }
+
+    TextureCacheHeader header;
+    header.content_hash = content_hash;
+    header.width = image.get_width();
+    header.height = image.get_height();
+    header.mip_count = static_cast<uint32_t>(mips.size());
+    header.format = format;
+    header.compression = TextureCompression::NONE;
+
+    auto offset = align_offset(
+        sizeof(TextureCacheHeader) + mips.size() * sizeof(TextureCacheMip));
+    for (size_t level = 0; level < mips.size(); level++)
+    {
+        mips[level].offset = offset;
+        mips[level].size = levels[level].size();
+        offset = align_offset(offset + mips[level].size);
+    }
+
+    // Write to a temporary file first so readers never map a partial file.
+    auto temporary_path = filepath;
+    temporary_path += ".tmp";
+
+    std::ofstream output_stream(temporary_path,
+        std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!output_stream)
+    {
+        PINE_CORE_ERROR("Could not open file '{0}'", temporary_path.string());
+        return false;
+    }
+
+    const auto write_padding = [&output_stream](const uint64_t target)
+    {
+        static constexpr std::array<char, s_data_alignment> zeros = {};
+        const auto position = static_cast<uint64_t>(output_stream.tellp());
+        output_stream.write(zeros.data(),
+            static_cast<std::streamsize>(target - position));
+    };
+
+    output_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output_stream.write(reinterpret_cast<const char*>(mips.data()),
+        static_cast<std::streamsize>(mips.size() * sizeof(TextureCacheMip)));
+    for (size_t level = 0; level < mips.size(); level++)
+    {
+        write_padding(mips[level].offset);
+        output_stream.write(reinterpret_cast<const char*>(levels[level].data()),
+            static_cast<std::streamsize>(levels[level].size()));
+    }
+    output_stream.close();
+
+    if (!output_stream)
+    {
+        PINE_CORE_ERROR("Could not write file '{0}'", temporary_path.string());
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temporary_path, filepath, ec);
+    return !ec;
+}
+
+} // namespace pine
@@ -0,0 +1,62 @@
+#include "pine/renderer/tilemap.hpp"
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+Tilemap::Tilemap(const uint32_t width, const uint32_t height,
+    const std::shared_ptr<Texture2D>& tileset, const uint32_t tileset_columns,
+    const uint32_t tileset_rows, const Vec3& position, const Vec2& tile_size)
+    : m_width(width), m_height(height),
+      m_chunk_columns((width + chunk_size - 1) / chunk_size),
+      m_chunk_rows((height + chunk_size - 1) / chunk_size), m_tileset(tileset),
+      m_tileset_columns(tileset_columns), m_tileset_rows(tileset_rows),
+      m_position(position), m_tile_size(tile_size)
+{
+    // Chunks on the edges are padded with empty tiles, so that all chunks are
+    // drawn with the same quad.
+    m_chunks.resize(m_chunk_columns * m_chunk_rows);
+    for (auto& chunk : m_chunks)
+    {
+        chunk.tiles.resize(chunk_size * chunk_size, empty_tile);
+        chunk.texture = IndexTexture2D::create(chunk_size, chunk_size);
+    }
+}
+
+void Tilemap::set_tile(const uint32_t x, const uint32_t y, const uint16_t tile)
+{
+    PINE_CORE_ASSERT(x < m_width && y < m_height, "Tile is outside the map.");
+
+    auto& chunk = m_chunks[(y / chunk_size) * m_chunk_columns + x / chunk_size];
+    auto& value = chunk.tiles[(y % chunk_size) * chunk_size + x % chunk_size];
+    if (value != tile)
+    {
+        value = tile;
+        chunk.dirty = true;
+    }
+}
+
+uint16_t Tilemap::get_tile(const uint32_t x, const uint32_t y) const
+{
+    PINE_CORE_ASSERT(x < m_width && y < m_height, "Tile is outside the map.");
+
+    const auto& chunk =
+        m_chunks[(y / chunk_size) * m_chunk_columns + x / chunk_size];
+    return chunk.tiles[(y % chunk_size) * chunk_size + x % chunk_size];
+}
+
+Mat4 Tilemap::get_chunk_transform(const uint32_t column,
+    const uint32_t row) const
+{
+    const auto chunk_extent = m_tile_size * static_cast<float>(chunk_size);
+    const auto corner = m_position
+        + Vec3(chunk_extent.x * static_cast<float>(column),
+            chunk_extent.y * static_cast<float>(row),
+            0.0f);
+
+    return translate(Mat4(1.0f), corner)
+        * scale(Mat4(1.0f), Vec3(chunk_extent.x, chunk_extent.y, 1.0f));
+}
+
+} // namespace pine
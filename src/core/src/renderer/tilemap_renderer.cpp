@@ -0,0 +1,187 @@
+#include "pine/renderer/tilemap_renderer.hpp"
+
+#include <array>
+#include <string>
+#include <utility>
+
+#include "pine/debug/gpu_instrumentor.hpp"
+#include "pine/pch.hpp"
+#include "pine/renderer/render_command.hpp"
+#include "pine/renderer/renderer.hpp"
+
+namespace pine
+{
+
+// A chunk is culled when all of its corners are outside of the same clip
+// plane, which also holds for rotated cameras.
+static bool is_chunk_visible(const Mat4& view_projection,
+    const Mat4& transform)
+{
+    static constexpr std::array<Vec4, 4> corners = {{
+        {0.0f, 0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 0.0f, 1.0f},
+        {1.0f, 1.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f},
+    }};
+
+    const auto model_view_projection = view_projection * transform;
+
+    auto left = true;
+    auto right = true;
+    auto bottom = true;
+    auto top = true;
+    for (const auto& corner : corners)
+    {
+        const auto clip = model_view_projection * corner;
+        left = left && clip.x < -clip.w;
+        right = right && clip.x > clip.w;
+        bottom = bottom && clip.y < -clip.w;
+        top = top && clip.y > clip.w;
+    }
+    return !(left || right || bottom || top);
+}
+
+TilemapRenderData TilemapRenderer::init(
+    const std::shared_ptr<Shader>& tilemap_shader)
+{
+    TilemapRenderData data;
+
+    const std::array<TilemapVertex, 4> vertices = {{
+        {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f}},
+        {{1.0f, 0.0f, 0.0f}, {1.0f, 0.0f}},
+        {{1.0f, 1.0f, 0.0f}, {1.0f, 1.0f}},
+        {{0.0f, 1.0f, 0.0f}, {0.0f, 1.0f}},
+    }};
+
+    auto vertex_buffer = VertexBuffer::create(
+        reinterpret_cast<const float*>(vertices.data()),
+        static_cast<uint32_t>(vertices.size() * sizeof(TilemapVertex)));
+    vertex_buffer->set_layout({
+        {"a_Position", ShaderDataType::Float3},
+        {"a_TexCoord", ShaderDataType::Float2},
+    });
+
+    data.chunk_vertex_array = VertexArray::create();
+    data.chunk_vertex_array->set_vertex_buffer(std::move(vertex_buffer));
+
+    const auto chunk_indices = create_quad_indices(1);
+    data.chunk_vertex_array->set_index_buffer(
+        IndexBuffer::create(chunk_indices.data(),
+            static_cast<uint32_t>(chunk_indices.size())));
+
+    data.tilemap_shader = tilemap_shader
+        ? tilemap_shader
+        : Shader::create("resources/shaders/tilemap_shader.glsl");
+
+    return data;
+}
+
+void TilemapRenderer::shutdown(TilemapRenderData& data)
+{
+    data.chunk_draws.clear();
+}
+
+void TilemapRenderer::begin_scene(TilemapRenderData& data)
+{
+    data.chunk_draws.clear();
+
+    data.statistics.draw_calls = 0;
+    data.statistics.chunk_count = 0;
+    data.statistics.culled_chunk_count = 0;
+    data.statistics.uploaded_chunk_count = 0;
+}
+
+void TilemapRenderer::end_scene(TilemapRenderData& data)
+{
+    if (data.chunk_draws.empty())
+    {
+        return;
+    }
+
+    flush(data);
+}
+
+void TilemapRenderer::flush(TilemapRenderData& data)
+{
+    PINE_PROFILE_FUNCTION();
+
+    // Longer than the small string buffer, which holds 15 characters in
+    // libstdc++ and MSVC, so constructing it on every call would allocate.
+    static const std::string columns_name = "u_TilesetColumns";
+
+    data.statistics.draw_calls +=
+        static_cast<uint32_t>(data.chunk_draws.size());
+
+    // The draws hold the textures until the render thread has drawn them.
+    RenderCommand::enqueue(
+        [draws = std::move(data.chunk_draws),
+            shader = data.tilemap_shader.get(),
+            vertex_array = data.chunk_vertex_array.get()]()
+        {
+            PINE_PROFILE_GPU_SCOPE("TilemapRenderer::flush");
+            shader->bind();
+            for (const auto& draw : draws)
+            {
+                draw.tileset->bind(0);
+                draw.tiles->bind(1);
+                shader->set_int(columns_name,
+                    static_cast<int>(draw.tileset_columns));
+                shader->set_int("u_TilesetRows",
+                    static_cast<int>(draw.tileset_rows));
+                shader->set_mat4("u_Transform", draw.transform);
+                RenderCommand::draw_indexed(*vertex_array);
+            }
+        });
+
+    data.chunk_draws.clear();
+}
+
+void TilemapRenderer::draw_tilemap(TilemapRenderData& data, Tilemap& tilemap)
+{
+    const auto& view_projection = Renderer::get_view_projection_matrix();
+    auto& chunks = tilemap.get_chunks();
+
+    for (uint32_t row = 0; row < tilemap.get_chunk_rows(); row++)
+    {
+        for (uint32_t column = 0; column < tilemap.get_chunk_columns();
+             column++)
+        {
+            const auto transform = tilemap.get_chunk_transform(column, row);
+            if (!is_chunk_visible(view_projection, transform))
+            {
+                data.statistics.culled_chunk_count++;
+                continue;
+            }
+
+            // Tiles of chunks outside of the view are uploaded once they
+            // become visible.
+            auto& chunk = chunks[row * tilemap.get_chunk_columns() + column];
+            if (chunk.dirty)
+            {
+                const auto size = static_cast<uint32_t>(
+                    chunk.tiles.size() * sizeof(uint16_t));
+                const auto tiles =
+                    RenderCommand::stage_data(chunk.tiles.data(), size);
+
+                RenderCommand::enqueue(
+                    [texture = chunk.texture, tiles]()
+                    {
+                        texture->set_data(
+                            static_cast<const uint16_t*>(tiles));
+                    });
+
+                chunk.dirty = false;
+                data.statistics.uploaded_chunk_count++;
+            }
+
+            data.chunk_draws.push_back({transform,
+                chunk.texture,
+                tilemap.get_tileset(),
+                tilemap.get_tileset_columns(),
+                tilemap.get_tileset_rows()});
+            data.statistics.chunk_count++;
+        }
+    }
+}
+
+} // namespace pine
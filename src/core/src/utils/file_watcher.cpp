@@ -0,0 +1,199 @@
+#include "pine/utils/file_watcher.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#if defined(PINE_PLATFORM_LINUX)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "pine/pch.hpp"
+
+namespace pine
+{
+
+static std::filesystem::path get_watch_path(
+    const std::filesystem::path& filepath)
+{
+    std::error_code error;
+    const auto path = std::filesystem::weakly_canonical(filepath, error);
+    return error ? std::filesystem::absolute(filepath).lexically_normal()
+                 : path;
+}
+
+FileWatcher::FileWatcher()
+{
+#if defined(PINE_PLATFORM_LINUX)
+    m_notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_notify_fd < 0)
+    {
+        PINE_CORE_WARN("Could not create inotify instance, polling files.");
+    }
+#endif
+    m_thread = std::thread(&FileWatcher::run, this);
+}
+
+FileWatcher::~FileWatcher()
+{
+    m_stop = true;
+    m_thread.join();
+#if defined(PINE_PLATFORM_LINUX)
+    if (m_notify_fd >= 0)
+    {
+        close(m_notify_fd);
+    }
+#endif
+}
+
+FileWatcher::WatchID FileWatcher::watch(const std::filesystem::path& filepath,
+    Callback callback)
+{
+    const auto path = get_watch_path(filepath);
+
+    std::error_code error;
+    const auto write_time = std::filesystem::last_write_time(path, error);
+
+    std::scoped_lock lock(m_mutex);
+    add_directory(path.parent_path());
+
+    const auto id = m_next_id++;
+    m_watches[id] = {path, std::move(callback), write_time};
+    return id;
+}
+
+void FileWatcher::unwatch(const WatchID id)
+{
+    std::scoped_lock lock(m_mutex);
+    m_watches.erase(id);
+}
+
+void FileWatcher::add_directory(const std::filesystem::path& directory)
+{
+#if defined(PINE_PLATFORM_LINUX)
+    if (m_notify_fd < 0)
+    {
+        return;
+    }
+
+    const auto it = std::find_if(m_directories.begin(),
+        m_directories.end(),
+        [&directory](const auto& entry) { return entry.second == directory; });
+    if (it != m_directories.end())
+    {
+        return;
+    }
+
+    // Editors either write the file in place or move a new file over it.
+    const auto descriptor = inotify_add_watch(m_notify_fd,
+        directory.c_str(),
+        IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (descriptor < 0)
+    {
+        PINE_CORE_WARN("Could not watch directory {0}.", directory.string());
+        return;
+    }
+    m_directories[descriptor] = directory;
+#endif
+}
+
+void FileWatcher::notify(const std::filesystem::path& filepath)
+{
+    // Callbacks are called without the lock, so that they may add watches.
+    std::vector<Callback> callbacks;
+    {
+        std::scoped_lock lock(m_mutex);
+        for (const auto& [id, watch] : m_watches)
+        {
+            if (watch.filepath == filepath)
+            {
+                callbacks.push_back(watch.callback);
+            }
+        }
+    }
+
+    for (const auto& callback : callbacks)
+    {
+        callback(filepath);
+    }
+}
+
+void FileWatcher::run()
+{
+    while (!m_stop)
+    {
+        std::vector<std::filesystem::path> changed_files;
+        const auto add_changed_file =
+            [&changed_files](const std::filesystem::path& filepath)
+        {
+            if (std::find(changed_files.begin(), changed_files.end(), filepath)
+                == changed_files.end())
+            {
+                changed_files.push_back(filepath);
+            }
+        };
+
+#if defined(PINE_PLATFORM_LINUX)
+        if (m_notify_fd >= 0)
+        {
+            pollfd descriptor = {m_notify_fd, POLLIN, 0};
+            const auto timeout = static_cast<int>(s_poll_interval.count());
+            if (poll(&descriptor, 1, timeout) <= 0)
+            {
+                continue;
+            }
+
+            // A save often shows up as several events, which are read as one
+            // batch.
+            alignas(inotify_event) std::array<char, 4096> buffer;
+            ssize_t length = 0;
+            while ((length = read(m_notify_fd, buffer.data(), buffer.size()))
+                > 0)
+            {
+                std::scoped_lock lock(m_mutex);
+                for (auto offset = 0; offset < length;)
+                {
+                    const auto* event = reinterpret_cast<const inotify_event*>(
+                        buffer.data() + offset);
+                    offset += static_cast<int>(sizeof(inotify_event)
+                        + event->len);
+
+                    const auto it = m_directories.find(event->wd);
+                    if (event->len == 0 || it == m_directories.end())
+                    {
+                        continue;
+                    }
+
+                    add_changed_file(it->second / event->name);
+                }
+            }
+        }
+        else
+#endif
+        {
+            std::this_thread::sleep_for(s_poll_interval);
+
+            std::scoped_lock lock(m_mutex);
+            for (auto& [id, watch] : m_watches)
+            {
+                std::error_code error;
+                const auto write_time =
+                    std::filesystem::last_write_time(watch.filepath, error);
+                if (!error && write_time != watch.write_time)
+                {
+                    watch.write_time = write_time;
+                    add_changed_file(watch.filepath);
+                }
+            }
+        }
+
+        for (const auto& filepath : changed_files)
+        {
+            notify(filepath);
+        }
+    }
+}
+
+} // namespace pine
@@ -24,13 +24,29 @@ public:
 private:
     void update_camera_controller(const Timestep& ts);
 
+    void render_scene_2d();
+    void render_scene_3d();
+
 private:
     // Rendering
     OrthographicCameraController camera_controller{1.0f};
+    PerspectiveCameraController perspective_controller{1.0f};
     ShaderLibrary shader_library{};
     std::shared_ptr<Framebuffer> viewport_framebuffer;
     std::shared_ptr<Texture2D> texture;
     QuadRenderData quad_render_data{};
+    LineRenderData line_render_data{};
+    CircleRenderData circle_render_data{};
+    TextRenderData text_render_data{};
+    std::unique_ptr<Font> font;
+    TilemapRenderData tilemap_render_data{};
+    std::unique_ptr<Tilemap> tilemap;
+    MeshRenderData mesh_render_data{};
+    MeshID cube_mesh = MeshRenderCaps::invalid_mesh;
+    MeshID point_cloud_mesh = MeshRenderCaps::invalid_mesh;
+    PointCloudRenderData point_cloud_render_data{};
+    // Released once it has been uploaded, or has failed to load.
+    std::shared_ptr<PointCloud> plant_point_cloud;
 
     // Network
     ClientState client{};
@@ -43,6 +59,7 @@ private:
     // Misc
     Vec4 quad_color{0.2f, 0.3f, 0.8f, 1.0f};
     float quad_rotation{0.0f};
+    bool show_3d_view{false};
 };
 
 } // namespace pine
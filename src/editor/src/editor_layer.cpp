@@ -18,10 +18,23 @@ void EditorLayer::on_attach()
         nullptr,
         io.Fonts->GetGlyphRangesCyrillic());
 
-    if (!shader_library.load_shader("resources/shaders/quad_shader.glsl"))
+    const std::vector<std::string> shader_paths = {
+        "resources/shaders/quad_shader.glsl",
+        "resources/shaders/line_shader.glsl",
+        "resources/shaders/circle_shader.glsl",
+        "resources/shaders/text_shader.glsl",
+        "resources/shaders/tilemap_shader.glsl",
+        "resources/shaders/mesh_shader.glsl",
+        "resources/shaders/point_cloud_shader.glsl",
+        "resources/shaders/point_cloud_cull_shader.glsl",
+    };
+    if (!shader_library.load_shaders(shader_paths,
+            &Application::get().get_job_system()))
     {
         PINE_ERROR("Failed to load shader.");
     }
+    shader_library.set_hot_reload(true);
+    Texture2D::set_hot_reload(true);
 
     gui::set_dark_theme(ImGui::GetStyle());
 
@@ -30,7 +43,76 @@ void EditorLayer::on_attach()
     specs.height = 0;
     viewport_framebuffer = Framebuffer::create(specs);
 
-    quad_render_data = QuadRenderer::init();
+    quad_render_data =
+        QuadRenderer::init(shader_library.get_shader("quad_shader"));
+    line_render_data =
+        LineRenderer::init(shader_library.get_shader("line_shader"));
+    circle_render_data =
+        CircleRenderer::init(shader_library.get_shader("circle_shader"));
+    text_render_data =
+        TextRenderer::init(shader_library.get_shader("text_shader"));
+    font = std::make_unique<Font>("resources/fonts/OpenSans-Regular.ttf");
+    tilemap_render_data =
+        TilemapRenderer::init(shader_library.get_shader("tilemap_shader"));
+
+    // Tileset of four plain colors, and a map of a million tiles.
+    const std::array<uint8_t, 16> tileset_pixels = {
+        40, 90, 40, 255,
+        60, 120, 50, 255,
+        120, 100, 70, 255,
+        50, 80, 140, 255,
+    };
+    const Image tileset(tileset_pixels.data(), 4, 1, ImageFormat::RGBA);
+    tilemap = std::make_unique<Tilemap>(1024,
+        1024,
+        Texture2D::create(tileset),
+        4,
+        1,
+        Vec3{-128.0f, -128.0f, -0.5f},
+        Vec2{0.25f, 0.25f});
+    for (uint32_t y = 0; y < tilemap->get_height(); y++)
+    {
+        for (uint32_t x = 0; x < tilemap->get_width(); x++)
+        {
+            tilemap->set_tile(x, y, static_cast<uint16_t>(1 + (x ^ y) % 4));
+        }
+    }
+
+    mesh_render_data =
+        MeshRenderer::init(shader_library.get_shader("mesh_shader"));
+    cube_mesh = MeshRenderer::upload_mesh(mesh_render_data, create_cube_mesh());
+
+    // Points spread evenly over a unit sphere, colored by their position.
+    MeshData point_cloud;
+    point_cloud.primitive = RendererPrimitives::Points;
+    const uint32_t point_count = 100000;
+    const auto golden_angle = 3.14159265f * (3.0f - std::sqrt(5.0f));
+    for (uint32_t index = 0; index < point_count; index++)
+    {
+        const auto y = 1.0f
+            - 2.0f * (static_cast<float>(index) + 0.5f)
+                / static_cast<float>(point_count);
+        const auto radius = std::sqrt(1.0f - y * y);
+        const auto angle = golden_angle * static_cast<float>(index);
+
+        MeshVertex vertex;
+        vertex.position =
+            Vec3(radius * std::cos(angle), y, radius * std::sin(angle));
+        vertex.color = Vec4(vertex.position * 0.5f + 0.5f, 1.0f);
+        point_cloud.vertices.push_back(vertex);
+        point_cloud.indices.push_back(index);
+    }
+    point_cloud_mesh = MeshRenderer::upload_mesh(mesh_render_data, point_cloud);
+
+    point_cloud_render_data = PointCloudRenderer::init(
+        shader_library.get_shader("point_cloud_shader"),
+        shader_library.get_shader("point_cloud_cull_shader"));
+    plant_point_cloud =
+        PointCloud::load("resources/point-clouds/Plant-VGA-Point-Cloud.ply",
+            Application::get().get_job_system());
+
+    perspective_controller.set_position({0.0f, 10.0f, 40.0f});
+    perspective_controller.set_orientation(0.0f, radians(-15.0f));
 
     server.set_connection_callback(
         [](const ConnectionState& connection) -> bool
@@ -51,7 +133,19 @@ void EditorLayer::on_attach()
     start_server(server);
 }
 
-void EditorLayer::on_detach() {}
+void EditorLayer::on_detach()
+{
+    PointCloudRenderer::shutdown(point_cloud_render_data);
+    MeshRenderer::shutdown(mesh_render_data);
+    TilemapRenderer::shutdown(tilemap_render_data);
+    TextRenderer::shutdown(text_render_data);
+    CircleRenderer::shutdown(circle_render_data);
+    LineRenderer::shutdown(line_render_data);
+    QuadRenderer::shutdown(quad_render_data);
+
+    shader_library.set_hot_reload(false);
+    Texture2D::set_hot_reload(false);
+}
 
 void EditorLayer::on_update(const Timestep& ts)
 {
@@ -62,6 +156,9 @@ void EditorLayer::on_update(const Timestep& ts)
 
     quad_rotation += ts * 50.0f;
 
+    shader_library.update_hot_reload();
+    Texture2D::update_hot_reload();
+
     RenderCommand::set_clear_color({0.1f, 0.1f, 0.1f, 1.0f});
     RenderCommand::clear();
 
@@ -69,8 +166,29 @@ void EditorLayer::on_update(const Timestep& ts)
     RenderCommand::set_clear_color({0.05f, 0.05f, 0.05f, 1.0f});
     RenderCommand::clear();
 
-    QuadRenderer::begin_scene(quad_render_data,
-        camera_controller.get_camera());
+    if (show_3d_view)
+    {
+        render_scene_3d();
+    }
+    else
+    {
+        render_scene_2d();
+    }
+    viewport_framebuffer->unbind();
+
+    update_server(server);
+}
+
+void EditorLayer::render_scene_2d()
+{
+    Renderer::begin_scene(camera_controller.get_camera(), viewport_panel.size);
+    TilemapRenderer::begin_scene(tilemap_render_data);
+    QuadRenderer::begin_scene(quad_render_data);
+    LineRenderer::begin_scene(line_render_data);
+    CircleRenderer::begin_scene(circle_render_data);
+    TextRenderer::begin_scene(text_render_data);
+
+    TilemapRenderer::draw_tilemap(tilemap_render_data, *tilemap);
 
     QuadRenderer::draw_rotated_quad(quad_render_data,
         {0.0f, 0.0f},
@@ -96,10 +214,85 @@ void EditorLayer::on_update(const Timestep& ts)
             Vec4{1.0f, 1.0f, 1.0f, 1.0f});
     }
 
+    LineRenderer::draw_rect(line_render_data,
+        {2.0f, 2.0f, 0.1f},
+        {0.7f, 0.95f},
+        {0.9f, 0.9f, 0.9f, 1.0f},
+        2.0f);
+    LineRenderer::draw_line(line_render_data,
+        {-1.0f, -1.5f},
+        {1.0f, -1.5f},
+        {0.2f, 0.8f, 0.3f, 1.0f},
+        4.0f);
+    CircleRenderer::draw_circle(circle_render_data,
+        {-2.0f, 2.0f, 0.1f},
+        0.5f,
+        {0.9f, 0.6f, 0.1f, 1.0f});
+    CircleRenderer::draw_circle(circle_render_data,
+        {-2.0f, -2.0f, 0.1f},
+        0.5f,
+        {0.3f, 0.7f, 0.9f, 1.0f},
+        0.1f);
+    TextRenderer::draw_text(text_render_data,
+        *font,
+        "Pine",
+        Vec3{-0.5f, 3.0f, 0.1f},
+        0.5f,
+        {1.0f, 1.0f, 1.0f, 1.0f});
+
+    TilemapRenderer::end_scene(tilemap_render_data);
     QuadRenderer::end_scene(quad_render_data);
-    viewport_framebuffer->unbind();
+    LineRenderer::end_scene(line_render_data);
+    CircleRenderer::end_scene(circle_render_data);
+    TextRenderer::end_scene(text_render_data);
+}
 
-    update_server(server);
+void EditorLayer::render_scene_3d()
+{
+    Renderer::begin_scene(perspective_controller.get_camera(),
+        viewport_panel.size);
+    MeshRenderer::begin_scene(mesh_render_data);
+
+    // A grid of a thousand cubes, which are drawn as instances of one
+    // indirect command.
+    const auto rotation = radians(quad_rotation);
+    for (int z = 0; z < 32; z++)
+    {
+        for (int x = 0; x < 32; x++)
+        {
+            const auto position = Vec3(static_cast<float>(x - 16) * 2.0f,
+                0.0f,
+                static_cast<float>(z - 16) * 2.0f);
+            const Mat4 transform = translate(Mat4(1.0f), position)
+                * rotate(Mat4(1.0f), rotation, Vec3(0.0f, 1.0f, 0.0f));
+            MeshRenderer::draw_mesh(mesh_render_data,
+                cube_mesh,
+                transform,
+                Vec4(static_cast<float>(x) / 32.0f,
+                    0.5f,
+                    static_cast<float>(z) / 32.0f,
+                    1.0f));
+        }
+    }
+
+    MeshRenderer::draw_mesh(mesh_render_data,
+        point_cloud_mesh,
+        translate(Mat4(1.0f), Vec3(0.0f, 8.0f, 0.0f))
+            * scale(Mat4(1.0f), Vec3(5.0f)));
+
+    MeshRenderer::end_scene(mesh_render_data);
+
+    // The point cloud is loaded in the background, and uploaded once when the
+    // job has finished. A failure to load or upload has been logged.
+    if (plant_point_cloud && !plant_point_cloud->is_loading())
+    {
+        PointCloudRenderer::upload_point_cloud(point_cloud_render_data,
+            plant_point_cloud);
+        plant_point_cloud.reset();
+    }
+    PointCloudRenderer::begin_scene(point_cloud_render_data,
+        perspective_controller.get_camera());
+    PointCloudRenderer::draw_point_cloud(point_cloud_render_data);
 }
 
 void EditorLayer::on_gui_render()
@@ -209,6 +402,8 @@ void EditorLayer::on_gui_render()
         camera_controller.on_resize(
             viewport_panel.size.x, 
             viewport_panel.size.y);
+        perspective_controller.on_resize(viewport_panel.size.x,
+            viewport_panel.size.y);
     }
 
     Application::get().get_graphical_interface().block_events(
@@ -223,6 +418,27 @@ void EditorLayer::on_gui_render()
             ImGui::Text("Quads: %d", stats.quad_count);
             ImGui::Text("Vertices: %d", stats.get_total_vertex_count());
             ImGui::Text("Indices: %d", stats.get_total_index_count());
+            ImGui::Text("Lines: %d, Circles: %d, Glyphs: %d",
+                line_render_data.statistics.line_count,
+                circle_render_data.statistics.circle_count,
+                text_render_data.statistics.glyph_count);
+            ImGui::Text("Tilemap Chunks: %d drawn, %d culled, %d uploaded",
+                tilemap_render_data.statistics.chunk_count,
+                tilemap_render_data.statistics.culled_chunk_count,
+                tilemap_render_data.statistics.uploaded_chunk_count);
+            ImGui::Text("Meshes: %d objects, %d draw calls",
+                mesh_render_data.statistics.object_count,
+                mesh_render_data.statistics.draw_calls);
+            ImGui::Text("Point Cloud: %d points, %d nodes, %d levels",
+                point_cloud_render_data.statistics.point_count,
+                point_cloud_render_data.statistics.node_count,
+                point_cloud_render_data.statistics.level_count);
+            ImGui::SliderFloat("Point Error",
+                &point_cloud_render_data.error_threshold,
+                0.5f,
+                16.0f);
+
+            ImGui::Checkbox("3D View", &show_3d_view);
 
             ImGui::ColorEdit4("Square Color", value_ptr(quad_color));
 
@@ -299,6 +515,74 @@ void EditorLayer::on_gui_render()
                 1.0);
         });
 
+    gui::render_window("Performance",
+        []
+        {
+            gui::metric_plot("CPU time (ms)",
+                Metrics::get_history(FrameMetric::CPU_TIME));
+            gui::metric_plot("GPU time (ms)",
+                Metrics::get_history(FrameMetric::GPU_TIME));
+            gui::metric_histogram("Timestep (ms)",
+                Metrics::get_history(FrameMetric::TIMESTEP));
+
+            gui::empty_space(0.0f, 10.0f);
+            ImGui::Separator();
+
+            gui::metric_plot("Draw calls",
+                Metrics::get_history(FrameMetric::DRAW_CALLS));
+            gui::metric_plot("Uploaded bytes",
+                Metrics::get_history(FrameMetric::UPLOADED_BYTES));
+            gui::metric_plot("Network bytes",
+                Metrics::get_history(FrameMetric::NETWORK_BYTES));
+            gui::metric_plot("Frame allocations",
+                Metrics::get_history(FrameMetric::FRAME_ALLOCATIONS));
+            gui::metric_plot("Frame heap allocations",
+                Metrics::get_history(FrameMetric::FRAME_HEAP_ALLOCATIONS));
+            gui::metric_plot("State changes",
+                Metrics::get_history(FrameMetric::STATE_CHANGES));
+            gui::metric_plot("Redundant state changes",
+                Metrics::get_history(FrameMetric::REDUNDANT_STATE_CHANGES));
+        });
+
+    gui::render_window("Memory",
+        []
+        {
+            if (!MemoryTracker::is_enabled())
+            {
+                ImGui::TextUnformatted("Memory tracking is disabled, build "
+                                       "with PINE_ENABLE_MEMORY_TRACKING.");
+                return;
+            }
+
+            if (ImGui::BeginTable("Memory", 4))
+            {
+                ImGui::TableSetupColumn("Tag");
+                ImGui::TableSetupColumn("Current (KB)");
+                ImGui::TableSetupColumn("Peak (KB)");
+                ImGui::TableSetupColumn("Allocations/s");
+                ImGui::TableHeadersRow();
+
+                for (uint32_t index = 0; index < memory_tag_count; index++)
+                {
+                    const auto tag = static_cast<MemoryTag>(index);
+                    const auto stats = MemoryTracker::get_statistics(tag);
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(MemoryTracker::get_name(tag));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f",
+                        static_cast<double>(stats.current_bytes) / 1024.0);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f",
+                        static_cast<double>(stats.peak_bytes) / 1024.0);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.0f",
+                        static_cast<double>(stats.allocations_per_second));
+                }
+                ImGui::EndTable();
+            }
+        });
+
     gui::render_window("Network",
         [this]()
         {
@@ -353,8 +637,10 @@ void EditorLayer::on_gui_render()
             ImGui::Text("Server messages:");
             for (const auto& message : server_history)
             {
-                ImGui::Text("%s",
-                    std::string(message.begin(), message.end()).c_str());
+                const FrameString text(message.begin(),
+                    message.end(),
+                    &FrameAllocator::get());
+                ImGui::TextUnformatted(text.c_str());
             }
         });
 
@@ -363,14 +649,46 @@ void EditorLayer::on_gui_render()
 
 void EditorLayer::on_event(Event& event)
 {
-    camera_controller.on_event(event);
+    if (show_3d_view)
+    {
+        perspective_controller.on_event(event);
+    }
+    else
+    {
+        camera_controller.on_event(event);
+    }
 }
 
 void EditorLayer::update_camera_controller(const Timestep& ts)
 {
     const auto& window = Application::get().get_window();
     const auto input_handle = pine::InputHandle::create(window);
-    
+
+    if (show_3d_view)
+    {
+        if (input_handle->is_key_pressed(KeyCode::W))
+            perspective_controller.move_forward(ts);
+        if (input_handle->is_key_pressed(KeyCode::S))
+            perspective_controller.move_backward(ts);
+        if (input_handle->is_key_pressed(KeyCode::A))
+            perspective_controller.move_left(ts);
+        if (input_handle->is_key_pressed(KeyCode::D))
+            perspective_controller.move_right(ts);
+        if (input_handle->is_key_pressed(KeyCode::E))
+            perspective_controller.move_up(ts);
+        if (input_handle->is_key_pressed(KeyCode::Q))
+            perspective_controller.move_down(ts);
+        if (input_handle->is_key_pressed(KeyCode::Left))
+            perspective_controller.turn_left(ts);
+        if (input_handle->is_key_pressed(KeyCode::Right))
+            perspective_controller.turn_right(ts);
+        if (input_handle->is_key_pressed(KeyCode::Up))
+            perspective_controller.look_up(ts);
+        if (input_handle->is_key_pressed(KeyCode::Down))
+            perspective_controller.look_down(ts);
+        return;
+    }
+
     if (input_handle->is_key_pressed(KeyCode::A))
         camera_controller.move_left(ts);
     if (input_handle->is_key_pressed(KeyCode::D))
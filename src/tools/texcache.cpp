@@ -0,0 +1,123 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "pine/pine.hpp"
+
+/*
+Writes pine texture cache files for images, so Texture2D::create can map them
+instead of decoding the source image.
+
+Usage: pine-texcache [-o <cache directory>] [--no-mips] <image|directory>...
+*/
+
+static bool is_image_file(const std::filesystem::path& filepath)
+{
+    const auto extension = filepath.extension();
+    return extension == ".png" || extension == ".jpg" || extension == ".tga"
+        || extension == ".bmp";
+}
+
+static bool cache_image(const std::filesystem::path& filepath,
+    const bool generate_mips)
+{
+    const auto content_hash = pine::hash_file_contents(filepath);
+    const auto cache_path = pine::get_texture_cache_path(content_hash);
+
+    if (pine::filesystem::exists(cache_path))
+    {
+        PINE_INFO("Up to date: {0}", filepath.string());
+        return true;
+    }
+
+    const auto image = pine::read_image(filepath);
+    if (image.get_width() == 0 || image.get_height() == 0)
+    {
+        PINE_ERROR("Could not read image: {0}", filepath.string());
+        return false;
+    }
+
+    if (!pine::write_texture_cache(cache_path,
+            image,
+            content_hash,
+            generate_mips))
+    {
+        PINE_ERROR("Could not write cache: {0}", cache_path.string());
+        return false;
+    }
+
+    PINE_INFO("Cached: {0} -> {1}", filepath.string(), cache_path.string());
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    pine::Log::init();
+
+    bool generate_mips = true;
+    std::vector<std::filesystem::path> inputs;
+    for (int index = 1; index < argc; index++)
+    {
+        const std::string argument = argv[index];
+        if (argument == "-o" && index + 1 < argc)
+        {
+            pine::set_texture_cache_directory(argv[++index]);
+        }
+        else if (argument == "--no-mips")
+        {
+            generate_mips = false;
+        }
+        else
+        {
+            inputs.emplace_back(argument);
+        }
+    }
+
+    if (inputs.empty())
+    {
+        PINE_ERROR("Usage: pine-texcache [-o <cache directory>] [--no-mips] "
+                   "<image|directory>...");
+        return 1;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(pine::get_texture_cache_directory(),
+        ec);
+    if (ec)
+    {
+        PINE_ERROR("Could not create cache directory: {0}", ec.message());
+        return 1;
+    }
+
+    uint32_t failures = 0;
+    for (const auto& input : inputs)
+    {
+        if (pine::filesystem::is_directory(input))
+        {
+            for (const auto& entry :
+                std::filesystem::recursive_directory_iterator(input))
+            {
+                if (entry.is_regular_file() && is_image_file(entry.path()))
+                {
+                    if (!cache_image(entry.path(), generate_mips))
+                    {
+                        failures++;
+                    }
+                }
+            }
+        }
+        else if (is_image_file(input))
+        {
+            if (!cache_image(input, generate_mips))
+            {
+                failures++;
+            }
+        }
+        else
+        {
+            PINE_WARN("Skipping unsupported file: {0}", input.string());
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}